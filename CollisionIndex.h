@@ -0,0 +1,302 @@
+#pragma once
+
+#include "sdk.hpp"
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+/**
+ * =============================================================================
+ * COLLISION BROAD-PHASE INDEX
+ * =============================================================================
+ *
+ * Per-frame uniform grid of collision-eligible minions and heroes.
+ *
+ * Built once per game_update (CustomPredictionSDK::update_trackers) and shared
+ * by every skillshot collision query in that tick. Units are binned by center
+ * into a compact cell-sorted array (counting sort), so a segment query only
+ * visits the cells inside the skillshot's swept corridor instead of scanning
+ * every object from the object manager.
+ *
+ * Usage:
+ *   CollisionIndex::ensure_current();
+ *   bool blocked = CollisionIndex::count_blocking_units(start, end, width,
+ *       CollisionIndex::MASK_MINIONS, target, source, 1) > 0;
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+    /**
+     * Collision-eligible unit cached for the current frame (XZ plane)
+     */
+    struct CollisionUnit
+    {
+        game_object* object;
+        float x;
+        float z;
+        float radius;           // Bounding radius
+        uint8_t kind;           // CollisionIndex::MASK_MINIONS or MASK_HEROES
+    };
+
+    class CollisionIndex
+    {
+    public:
+        static constexpr uint8_t MASK_MINIONS = 1 << 0;
+        static constexpr uint8_t MASK_HEROES = 1 << 1;
+
+        static constexpr float CELL_SIZE = 300.f;           // ~ minion wave spacing
+        static constexpr int MAX_CELLS_PER_AXIS = 64;       // Cell size grows past this extent
+
+        /**
+         * Units that can block skillshots (alive, targetable, visible)
+         */
+        static bool is_collision_eligible(game_object* obj)
+        {
+            if (!obj || !obj->is_valid() || obj->is_dead())
+                return false;
+
+            // Object must be targetable
+            if (!obj->is_targetable())
+                return false;
+
+            // Check visibility
+            if (!obj->is_visible())
+                return false;
+
+            return true;
+        }
+
+        /**
+         * Rebuild the grid from the object manager (call once per game_update)
+         */
+        static void rebuild(float current_time)
+        {
+            build_time_ = current_time;
+            units_.clear();
+            max_radius_ = 0.f;
+
+            if (!g_sdk || !g_sdk->object_manager)
+            {
+                reset_cells();
+                return;
+            }
+
+            auto minions = g_sdk->object_manager->get_minions();
+            for (auto* minion : minions)
+                add_unit(minion, MASK_MINIONS);
+
+            auto heroes = g_sdk->object_manager->get_heroes();
+            for (auto* hero : heroes)
+                add_unit(hero, MASK_HEROES);
+
+            bin_units();
+        }
+
+        /**
+         * Rebuild if the grid was not built this tick (queries before the first update)
+         */
+        static void ensure_current()
+        {
+            if (!g_sdk || !g_sdk->clock_facade)
+                return;
+
+            float current_time = g_sdk->clock_facade->get_game_time();
+            if (current_time != build_time_)
+                rebuild(current_time);
+        }
+
+        /**
+         * Count units whose hitbox overlaps the segment start->end widened by width
+         * Units must project inside [start, end]; exclude_a/exclude_b are skipped.
+         * Stops early once max_count is reached (max_count <= 0 = unlimited).
+         */
+        static int count_blocking_units(
+            const math::vector3& start,
+            const math::vector3& end,
+            float width,
+            uint8_t kind_mask,
+            const game_object* exclude_a = nullptr,
+            const game_object* exclude_b = nullptr,
+            int max_count = 0)
+        {
+            if (units_.empty() || cells_x_ == 0)
+                return 0;
+
+            // Segment invariants hoisted out of the per-unit test
+            float dx = end.x - start.x;
+            float dz = end.z - start.z;
+            float length = std::sqrt(dx * dx + dz * dz);
+            float dir_x = length > 1e-4f ? dx / length : 0.f;
+            float dir_z = length > 1e-4f ? dz / length : 0.f;
+
+            // A unit center can be at most width + radius from the segment
+            float inflate = width + max_radius_;
+            float inv_cell = 1.f / cell_size_;
+
+            int count = 0;
+            for (int ix = 0; ix < cells_x_; ++ix)
+            {
+                // Portion of the segment inside this column's inflated slab
+                float slab_lo = origin_x_ + ix * cell_size_ - inflate;
+                float slab_hi = slab_lo + cell_size_ + 2.f * inflate;
+
+                float t0 = 0.f;
+                float t1 = 1.f;
+                if (std::abs(dx) < 1e-4f)
+                {
+                    if (start.x < slab_lo || start.x > slab_hi)
+                        continue;
+                }
+                else
+                {
+                    float ta = (slab_lo - start.x) / dx;
+                    float tb = (slab_hi - start.x) / dx;
+                    t0 = std::max(t0, std::min(ta, tb));
+                    t1 = std::min(t1, std::max(ta, tb));
+                    if (t0 > t1)
+                        continue;
+                }
+
+                float za = start.z + dz * t0;
+                float zb = start.z + dz * t1;
+                int iz_min = cell_coord(std::min(za, zb) - inflate - origin_z_, inv_cell, cells_z_);
+                int iz_max = cell_coord(std::max(za, zb) + inflate - origin_z_, inv_cell, cells_z_);
+
+                uint32_t first = cell_start_[ix * cells_z_ + iz_min];
+                uint32_t last = cell_start_[ix * cells_z_ + iz_max + 1];
+
+                for (uint32_t i = first; i < last; ++i)
+                {
+                    const CollisionUnit& unit = units_[i];
+                    if (!(unit.kind & kind_mask))
+                        continue;
+                    if (unit.object == exclude_a || unit.object == exclude_b)
+                        continue;
+
+                    // Point-to-line distance (projection must land on the segment)
+                    float to_x = unit.x - start.x;
+                    float to_z = unit.z - start.z;
+                    float projection = to_x * dir_x + to_z * dir_z;
+                    if (projection < 0.f || projection > length)
+                        continue;
+
+                    float perp_x = to_x - dir_x * projection;
+                    float perp_z = to_z - dir_z * projection;
+                    float reach = width + unit.radius;
+                    if (perp_x * perp_x + perp_z * perp_z > reach * reach)
+                        continue;
+
+                    ++count;
+                    if (max_count > 0 && count >= max_count)
+                        return count;
+                }
+            }
+
+            return count;
+        }
+
+        static const std::vector<CollisionUnit>& get_units() { return units_; }
+
+        static void clear()
+        {
+            units_.clear();
+            reset_cells();
+            build_time_ = -1.f;
+        }
+
+    private:
+        static void add_unit(game_object* obj, uint8_t kind)
+        {
+            if (!is_collision_eligible(obj))
+                return;
+
+            math::vector3 position = obj->get_position();
+            float radius = obj->get_bounding_radius();
+            units_.push_back(CollisionUnit{ obj, position.x, position.z, radius, kind });
+            max_radius_ = std::max(max_radius_, radius);
+        }
+
+        static int cell_coord(float offset, float inv_cell, int cells)
+        {
+            int c = static_cast<int>(std::floor(offset * inv_cell));
+            return std::clamp(c, 0, cells - 1);
+        }
+
+        static void reset_cells()
+        {
+            cells_x_ = 0;
+            cells_z_ = 0;
+            cell_start_.clear();
+        }
+
+        // Counting sort units into cell order, cell_start_ holds CSR offsets
+        static void bin_units()
+        {
+            if (units_.empty())
+            {
+                reset_cells();
+                return;
+            }
+
+            float min_x = units_[0].x, max_x = units_[0].x;
+            float min_z = units_[0].z, max_z = units_[0].z;
+            for (const CollisionUnit& unit : units_)
+            {
+                min_x = std::min(min_x, unit.x);
+                max_x = std::max(max_x, unit.x);
+                min_z = std::min(min_z, unit.z);
+                max_z = std::max(max_z, unit.z);
+            }
+
+            float extent = std::max(max_x - min_x, max_z - min_z);
+            cell_size_ = std::max(CELL_SIZE, extent / (MAX_CELLS_PER_AXIS - 1));
+            origin_x_ = min_x;
+            origin_z_ = min_z;
+
+            float inv_cell = 1.f / cell_size_;
+            cells_x_ = std::min(MAX_CELLS_PER_AXIS, static_cast<int>((max_x - min_x) * inv_cell) + 1);
+            cells_z_ = std::min(MAX_CELLS_PER_AXIS, static_cast<int>((max_z - min_z) * inv_cell) + 1);
+
+            size_t cell_count = static_cast<size_t>(cells_x_) * cells_z_;
+            cell_start_.assign(cell_count + 1, 0);
+            unit_cells_.resize(units_.size());
+
+            for (size_t i = 0; i < units_.size(); ++i)
+            {
+                int ix = cell_coord(units_[i].x - origin_x_, inv_cell, cells_x_);
+                int iz = cell_coord(units_[i].z - origin_z_, inv_cell, cells_z_);
+                unit_cells_[i] = static_cast<uint32_t>(ix * cells_z_ + iz);
+                ++cell_start_[unit_cells_[i] + 1];
+            }
+
+            for (size_t c = 0; c < cell_count; ++c)
+                cell_start_[c + 1] += cell_start_[c];
+
+            sorted_units_.resize(units_.size());
+            cell_fill_.assign(cell_start_.begin(), cell_start_.end() - 1);
+            for (size_t i = 0; i < units_.size(); ++i)
+                sorted_units_[cell_fill_[unit_cells_[i]]++] = units_[i];
+
+            units_.swap(sorted_units_);
+        }
+
+        static inline std::vector<CollisionUnit> units_;          // Sorted by cell after bin_units()
+        static inline std::vector<uint32_t> cell_start_;          // CSR offsets, cells_x_ * cells_z_ + 1
+        static inline float origin_x_ = 0.f;
+        static inline float origin_z_ = 0.f;
+        static inline float cell_size_ = CELL_SIZE;
+        static inline int cells_x_ = 0;
+        static inline int cells_z_ = 0;
+        static inline float max_radius_ = 0.f;
+        static inline float build_time_ = -1.f;
+
+        // Rebuild scratch (kept to avoid per-frame allocations)
+        static inline std::vector<CollisionUnit> sorted_units_;
+        static inline std::vector<uint32_t> unit_cells_;
+        static inline std::vector<uint32_t> cell_fill_;
+    };
+
+} // namespace HybridPred
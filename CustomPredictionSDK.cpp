@@ -1,5 +1,7 @@
 #include "CustomPredictionSDK.h"
 #include "EdgeCaseDetection.h"
+#include "PredictionLogger.h"
+#include "PredictionProfiler.h"
 #include <algorithm>
 #include <limits>
 
@@ -70,11 +72,11 @@ pred_sdk::pred_data CustomPredictionSDK::predict(game_object* obj, pred_sdk::spe
         return result;
     }
 
-    // DEBUG: Log that Danny.Prediction is being used (remove after testing)
+    // Log that Danny.Prediction is being used
     static bool first_call = true;
     if (first_call)
     {
-        g_sdk->log_console("[Danny.Prediction] Active and predicting!");
+        HYBRID_LOG_INFO("Active and predicting!");
         first_call = false;
     }
 
@@ -82,21 +84,16 @@ pred_sdk::pred_data CustomPredictionSDK::predict(game_object* obj, pred_sdk::spe
     HybridPred::HybridPredictionResult hybrid_result =
         HybridPred::PredictionManager::predict(spell_data.source, obj, spell_data);
 
-    // DEBUG: Log prediction details
-    char debug_msg[256];
-    sprintf_s(debug_msg, "[Danny.Prediction] Target: %s | Valid: %s | HitChance: %.2f",
-        obj->get_char_name().c_str(),
+    // Prediction details (buffered; arguments only evaluated at debug level)
+    HYBRID_LOG_DEBUG("Target: {} | Valid: {} | HitChance: {}",
+        obj->get_char_name(),
         hybrid_result.is_valid ? "YES" : "NO",
         hybrid_result.hit_chance);
-    g_sdk->log_console(debug_msg);
 
     if (!hybrid_result.is_valid)
     {
-        if (!hybrid_result.reasoning.empty())
-        {
-            sprintf_s(debug_msg, "[Danny.Prediction] Reason invalid: %s", hybrid_result.reasoning.c_str());
-            g_sdk->log_console(debug_msg);
-        }
+        if (hybrid_result.reason && hybrid_result.reason[0] != '\0')
+            HYBRID_LOG_DEBUG("Reason invalid: {}", hybrid_result.reason);
         result.hitchance = pred_sdk::hitchance::any;
         return result;
     }
@@ -104,11 +101,9 @@ pred_sdk::pred_data CustomPredictionSDK::predict(game_object* obj, pred_sdk::spe
     // Convert hybrid result to pred_data
     result = convert_to_pred_data(hybrid_result, obj, spell_data);
 
-    // DEBUG: Log final hitchance
-    sprintf_s(debug_msg, "[Danny.Prediction] Final enum hitchance: %d (thresh >= %d?)",
+    HYBRID_LOG_DEBUG("Final enum hitchance: {} (thresh >= {}?)",
         static_cast<int>(result.hitchance),
         spell_data.expected_hitchance);
-    g_sdk->log_console(debug_msg);
 
     // Check collision if required
     if (!spell_data.forbidden_collisions.empty())
@@ -158,6 +153,14 @@ math::vector3 CustomPredictionSDK::predict_on_path(game_object* obj, float time,
         return position;
     }
 
+    // Moving along a path: follow the waypoints (cached, binary search) and stop at the end
+    if (obj->is_moving() && !obj->is_dashing())
+    {
+        const HybridPred::PathCache& path = tracker->get_path_cache();
+        if (path.size() >= 2)
+            return path.position_at(position, obj->get_current_path_index(), obj->get_move_speed() * time);
+    }
+
     // Use physics predictor with current velocity
     math::vector3 current_velocity = tracker->get_current_velocity();
     return HybridPred::PhysicsPredictor::predict_linear_position(
@@ -296,6 +299,8 @@ pred_sdk::pred_data CustomPredictionSDK::convert_to_pred_data(
     game_object* target,
     const pred_sdk::spell_data& spell_data)
 {
+    HYBRID_PROFILE_SCOPE(conversion);
+
     pred_sdk::pred_data result{};
 
     // Copy positions
@@ -352,8 +357,7 @@ game_object* CustomPredictionSDK::get_best_target(const pred_sdk::spell_data& sp
     }
 
     // Fallback: Find best target based on hybrid prediction score
-    game_object* best_target = nullptr;
-    float best_score = -1.f;
+    std::vector<game_object*> candidates;
 
     auto all_heroes = g_sdk->object_manager->get_heroes();
     for (auto* hero : all_heroes)
@@ -366,13 +370,24 @@ game_object* CustomPredictionSDK::get_best_target(const pred_sdk::spell_data& sp
         if (distance > spell_data.range + 200.f) // Add buffer
             continue;
 
+        candidates.push_back(hero);
+    }
+
+    // One batch: edge cases analyzed once per candidate and reused by the prediction
+    auto batch = HybridPred::PredictionManager::predict_batch(spell_data.source, candidates, { spell_data });
+
+    game_object* best_target = nullptr;
+    float best_score = -1.f;
+
+    for (const auto& prediction : batch)
+    {
         // Calculate score
-        float score = calculate_target_score(hero, spell_data);
+        float score = calculate_target_score(prediction, spell_data);
 
         if (score > best_score)
         {
             best_score = score;
-            best_target = hero;
+            best_target = prediction.target;
         }
     }
 
@@ -380,14 +395,14 @@ game_object* CustomPredictionSDK::get_best_target(const pred_sdk::spell_data& sp
 }
 
 float CustomPredictionSDK::calculate_target_score(
-    game_object* target,
+    const HybridPred::BatchPrediction& prediction,
     const pred_sdk::spell_data& spell_data)
 {
-    if (!target || !target->is_valid())
+    game_object* target = prediction.target;
+    if (!target || !target->is_valid() || prediction.results.empty())
         return 0.f;
 
-    // Analyze edge cases for this target
-    EdgeCases::EdgeCaseAnalysis edge_cases = EdgeCases::analyze_target(target, spell_data.source);
+    const EdgeCases::EdgeCaseAnalysis& edge_cases = prediction.edge_cases;
 
     // Filter out invalid targets
     if (edge_cases.is_clone)
@@ -396,9 +411,7 @@ float CustomPredictionSDK::calculate_target_score(
     if (edge_cases.blocked_by_windwall)
         return 0.f;  // Can't hit through windwall
 
-    // Get hybrid prediction for this target
-    HybridPred::HybridPredictionResult pred_result =
-        HybridPred::PredictionManager::predict(spell_data.source, target, spell_data);
+    const HybridPred::HybridPredictionResult& pred_result = prediction.results.front();
 
     if (!pred_result.is_valid)
         return 0.f;
@@ -422,86 +435,41 @@ bool CustomPredictionSDK::check_collision_simple(
     const pred_sdk::spell_data& spell_data,
     const game_object* target_obj)
 {
-    // Check each collision type
+    HYBRID_PROFILE_SCOPE(collision);
+
+    // Gather collision types into one broad-phase query
+    uint8_t kind_mask = 0;
+    bool check_terrain = false;
     for (auto collision_type : spell_data.forbidden_collisions)
     {
         if (collision_type == pred_sdk::collision_type::unit)
-        {
-            auto minions = g_sdk->object_manager->get_minions();
-            for (auto* minion : minions)
-            {
-                if (!minion || minion == target_obj)
-                    continue;
-
-                if (!is_collision_object(minion, spell_data))
-                    continue;
-
-                // Simple point-to-line distance check
-                math::vector3 minion_pos = minion->get_position();
-                math::vector3 line_dir = (end - start).normalized();
-                math::vector3 to_minion = minion_pos - start;
-
-                float projection = to_minion.dot(line_dir);
-                float line_length = start.distance(end);
-
-                if (projection < 0.f || projection > line_length)
-                    continue;
-
-                math::vector3 closest_point = start + line_dir * projection;
-                float distance = minion_pos.distance(closest_point);
-
-                if (distance <= spell_data.radius + minion->get_bounding_radius())
-                    return true;
-            }
-        }
+            kind_mask |= HybridPred::CollisionIndex::MASK_MINIONS;
         else if (collision_type == pred_sdk::collision_type::hero)
-        {
-            auto heroes = g_sdk->object_manager->get_heroes();
-            for (auto* hero : heroes)
-            {
-                if (!hero || hero == target_obj || hero == spell_data.source)
-                    continue;
-
-                if (!is_collision_object(hero, spell_data))
-                    continue;
-
-                math::vector3 hero_pos = hero->get_position();
-                math::vector3 line_dir = (end - start).normalized();
-                math::vector3 to_hero = hero_pos - start;
-
-                float projection = to_hero.dot(line_dir);
-                float line_length = start.distance(end);
-
-                if (projection < 0.f || projection > line_length)
-                    continue;
+            kind_mask |= HybridPred::CollisionIndex::MASK_HEROES;
+        else if (collision_type == pred_sdk::collision_type::terrain)
+            check_terrain = true;
+    }
 
-                math::vector3 closest_point = start + line_dir * projection;
-                float distance = hero_pos.distance(closest_point);
+    // Terrain: walkability bitmap lookups along the path (no navmesh calls per query);
+    // the spell radius at the end already reaches a target hugging a wall
+    if (check_terrain && HybridPred::NavGrid::segment_blocked(start, end, spell_data.radius))
+        return true;
 
-                if (distance <= spell_data.radius + hero->get_bounding_radius())
-                    return true;
-            }
-        }
-        // Terrain collision skipped - would need navmesh API
-    }
+    if (kind_mask == 0)
+        return false;
 
-    return false;
+    // Grid is rebuilt per game_update; only cells along the skillshot are visited
+    HybridPred::CollisionIndex::ensure_current();
+    return HybridPred::CollisionIndex::count_blocking_units(
+        start, end, spell_data.radius, kind_mask, target_obj, spell_data.source, 1) > 0;
 }
 
 bool CustomPredictionSDK::is_collision_object(
     game_object* obj,
     const pred_sdk::spell_data& spell_data)
 {
-    if (!obj || !obj->is_valid() || obj->is_dead())
-        return false;
-
-    // Object must be targetable
-    if (!obj->is_targetable())
-        return false;
-
-    // Check visibility
-    if (!obj->is_visible())
-        return false;
+    (void)spell_data;
 
-    return true;
+    // Shared with the collision broad-phase so both agree on eligibility
+    return HybridPred::CollisionIndex::is_collision_eligible(obj);
 }
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 #include "sdk.hpp"
 #include "HybridPrediction.h"
+#include "CollisionIndex.h"
+#include "NavGrid.h"
+#include "PredictionLogger.h"
 #include <string>
 
 /**
@@ -118,7 +121,8 @@ public:
     // =========================================================================
 
     /**
-     * Update all behavior trackers
+     * Update all behavior trackers, rebuild the collision broad-phase grid and
+     * flush buffered log events (throttled)
      * IMPORTANT: Call this every frame in your main loop or on_update callback
      */
     static void update_trackers();
@@ -150,12 +154,12 @@ private:
     game_object* get_best_target(const pred_sdk::spell_data& spell_data);
 
     /**
-     * Calculate hit chance score for target prioritization
+     * Calculate hit chance score for target prioritization (from a batched prediction)
      */
-    float calculate_target_score(game_object* target, const pred_sdk::spell_data& spell_data);
+    float calculate_target_score(const HybridPred::BatchPrediction& prediction, const pred_sdk::spell_data& spell_data);
 
     /**
-     * Simple collision check (simplified implementation)
+     * Segment collision check against the per-frame CollisionIndex grid
      */
     bool check_collision_simple(
         const math::vector3& start,
@@ -181,6 +185,7 @@ inline CustomPredictionSDK::CustomPredictionSDK()
 inline CustomPredictionSDK::~CustomPredictionSDK()
 {
     HybridPred::PredictionManager::clear();
+    HybridPred::CollisionIndex::clear();
 }
 
 inline pred_sdk::utils* CustomPredictionSDK::util()
@@ -191,4 +196,11 @@ inline pred_sdk::utils* CustomPredictionSDK::util()
 inline void CustomPredictionSDK::update_trackers()
 {
     HybridPred::PredictionManager::update();
+
+    if (g_sdk && g_sdk->clock_facade)
+    {
+        float current_time = g_sdk->clock_facade->get_game_time();
+        HybridPred::CollisionIndex::rebuild(current_time);
+        HybridPred::Log::flush(current_time);
+    }
 }
\ No newline at end of file
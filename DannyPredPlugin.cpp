@@ -1,5 +1,8 @@
 #include "sdk.hpp"
 #include "CustomPredictionSDK.h"
+#include "PredictionProfiler.h"
+#include "ProfileStore.h"
+#include "PredictionTelemetry.h"
 
 CustomPredictionSDK customPrediction;
 
@@ -12,21 +15,47 @@ void __fastcall on_update()
     CustomPredictionSDK::update_trackers();
 }
 
+// Cast callback: links the local player's casts to their predictions (outcome telemetry)
+void __fastcall on_process_cast(game_object* object, spell_cast* cast)
+{
+    HybridPred::Telemetry::Recorder::on_process_cast(object, cast);
+}
+
 namespace Prediction
 {
     void LoadPrediction()
     {
         // Register update callback for tracker updates
         g_sdk->event_manager->register_callback(event_manager::event::game_update, reinterpret_cast<void*>(on_update));
+        g_sdk->event_manager->register_callback(event_manager::event::process_cast, reinterpret_cast<void*>(on_process_cast));
+
+        // Terrain walkability bitmap (static for the game, sampled once)
+        HybridPred::NavGrid::build();
+
+        // Champion behavior priors from earlier games (mapped, merged in place)
+        if (PredictionConfig::get().enable_behavior_profiles)
+            HybridPred::ProfileStore::open(PredictionConfig::get().profile_path);
+
+        // Stage profiler overlay (no-op unless HYBRID_PRED_ENABLE_PROFILER)
+        HybridPred::Profiler::initialize();
     }
 
     void UnloadPrediction()
     {
         // Unregister callback
         g_sdk->event_manager->unregister_callback(event_manager::event::game_update, reinterpret_cast<void*>(on_update));
+        g_sdk->event_manager->unregister_callback(event_manager::event::process_cast, reinterpret_cast<void*>(on_process_cast));
+
+        // Print anything still buffered before tearing down
+        HybridPred::Log::flush(0.f, true);
+        HybridPred::Profiler::shutdown();
 
-        // Clean up all trackers
+        // Clean up all trackers; also joins the PDF worker and telemetry writer,
+        // which must not outlive the module
         HybridPred::PredictionManager::clear();
+        HybridPred::ProfileStore::close();
+        HybridPred::CollisionIndex::clear();
+        HybridPred::NavGrid::clear();
     }
 }
 
@@ -3,8 +3,12 @@
 #include "sdk.hpp"
 #include "StandalonePredictionSDK.h"  // MUST be included AFTER sdk.hpp for compatibility
 #include "PredictionConfig.h"
+#include "CollisionIndex.h"
 #include <vector>
 #include <string>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
 
 /**
  * =============================================================================
@@ -25,6 +29,142 @@
 
 namespace EdgeCases
 {
+    // =========================================================================
+    // BUFF STATE CAPTURE
+    // =========================================================================
+
+    /**
+     * Buffs the edge case checks look up by name
+     */
+    enum class NamedBuff : uint8_t
+    {
+        zhonyas,
+        guardian_angel,
+        bard_r,
+        lissandra_r,
+        recall,
+        banshees,
+        sivir_shield,
+        nocturne_shroud,
+        morgana_shield,
+        malzahar_shield,
+        shaco_clone,
+        wukong_clone,
+        leblanc_clone,
+        neeko_clone,
+        count
+    };
+
+    inline constexpr const char* NAMED_BUFF_NAMES[] = {
+        "zhonyasringshield", "willrevive", "bardrstasis", "lissandrarstasis", "recall",
+        "bansheesveil", "sivirshield", "nocturneshroudofdarkness", "morganablackshield", "malzaharpassiveshield",
+        "shacopassive", "monkeykingdecoy", "leblancpassive", "neekopassive"
+    };
+    static_assert(sizeof(NAMED_BUFF_NAMES) / sizeof(NAMED_BUFF_NAMES[0]) == static_cast<size_t>(NamedBuff::count));
+
+    constexpr uint64_t buff_type_bit(buff_type type) { return uint64_t{ 1 } << static_cast<uint8_t>(type); }
+    constexpr uint16_t named_buff_bit(NamedBuff buff) { return static_cast<uint16_t>(1u << static_cast<uint8_t>(buff)); }
+
+    /**
+     * Packed buff state from one pass over game_object::get_buffs()
+     * Replaces per-check has_buff_of_type / get_buff_by_name virtual calls.
+     * Cached per target in the frame snapshot (get_frame_buff_state); tracker
+     * samples keep only the derived CC bit (MovementSnapshot::is_cced).
+     */
+    struct BuffState
+    {
+        static constexpr size_t NAMED_COUNT = static_cast<size_t>(NamedBuff::count);
+
+        uint64_t type_mask = 0;         // Bit per buff_type with an active buff
+        uint16_t named_mask = 0;        // Bit per NamedBuff present
+        uint16_t named_active_mask = 0; // Bit per NamedBuff present and is_active()
+        float named_end_time[NAMED_COUNT] = {};
+
+        // Hard CC that stops movement (stun, charm, fear, snare, taunt, suppression, knockup)
+        static constexpr uint64_t CC_MASK =
+            buff_type_bit(buff_type::stun) | buff_type_bit(buff_type::charm) | buff_type_bit(buff_type::fear) |
+            buff_type_bit(buff_type::snare) | buff_type_bit(buff_type::taunt) | buff_type_bit(buff_type::suppression) |
+            buff_type_bit(buff_type::knockup);
+
+        bool has_type(buff_type type) const { return (type_mask & buff_type_bit(type)) != 0; }
+        bool has(NamedBuff buff) const { return (named_mask & named_buff_bit(buff)) != 0; }
+        bool is_active(NamedBuff buff) const { return (named_active_mask & named_buff_bit(buff)) != 0; }
+        float end_time(NamedBuff buff) const { return named_end_time[static_cast<size_t>(buff)]; }
+        bool is_cced() const { return (type_mask & CC_MASK) != 0; }
+    };
+
+    /**
+     * Buff hash -> NamedBuff index (count = not a named buff)
+     * Learned on first sight so get_name() runs once per distinct buff hash.
+     */
+    inline std::unordered_map<uint32_t, uint8_t>& named_buff_hashes()
+    {
+        static std::unordered_map<uint32_t, uint8_t> table;
+        return table;
+    }
+
+    inline uint8_t classify_named_buff(buff_instance* buff)
+    {
+        auto& table = named_buff_hashes();
+        uint32_t hash = buff->get_hash();
+
+        auto it = table.find(hash);
+        if (it != table.end())
+            return it->second;
+
+        uint8_t index = static_cast<uint8_t>(NamedBuff::count);
+        std::string name = buff->get_name();
+        for (size_t i = 0; i < BuffState::NAMED_COUNT; ++i)
+        {
+            if (name == NAMED_BUFF_NAMES[i])
+            {
+                index = static_cast<uint8_t>(i);
+                break;
+            }
+        }
+
+        table.emplace(hash, index);
+        return index;
+    }
+
+    /**
+     * Single pass over the target's buff list
+     */
+    inline BuffState capture_buff_state(game_object* target)
+    {
+        BuffState state;
+
+        if (!target || !target->is_valid())
+            return state;
+
+        auto buffs = target->get_buffs();
+        for (auto* buff : buffs)
+        {
+            if (!buff)
+                continue;
+
+            // Type bits follow has_buff_of_type: expired / inactive entries don't count
+            bool active = buff->is_active();
+            uint8_t type = static_cast<uint8_t>(buff->get_type());
+            if (active && type < 64)
+                state.type_mask |= uint64_t{ 1 } << type;
+
+            uint8_t named = classify_named_buff(buff);
+            if (named >= BuffState::NAMED_COUNT)
+                continue;
+
+            uint16_t bit = static_cast<uint16_t>(1u << named);
+            state.named_mask |= bit;
+            if (active)
+            {
+                state.named_active_mask |= bit;
+                state.named_end_time[named] = std::max(state.named_end_time[named], buff->get_end_time());
+            }
+        }
+
+        return state;
+    }
+
     // =========================================================================
     // STASIS DETECTION AND TIMING
     // =========================================================================
@@ -37,7 +177,7 @@ namespace EdgeCases
         bool is_in_stasis;
         float end_time;                 // Game time when stasis ends
         math::vector3 exit_position;    // Where target will be (current pos)
-        std::string stasis_type;        // "zhonyas", "ga", "bard_r", etc.
+        const char* stasis_type;        // "zhonyas", "ga", "bard_r", etc. (string literal)
 
         StasisInfo() : is_in_stasis(false), end_time(0.f), exit_position{}, stasis_type("") {}
     };
@@ -45,64 +185,42 @@ namespace EdgeCases
     /**
      * Detect if target is in stasis and get timing info
      */
-    inline StasisInfo detect_stasis(game_object* target)
+    inline StasisInfo detect_stasis(game_object* target, const BuffState& buffs)
     {
         StasisInfo info;
 
         if (!target || !target->is_valid())
             return info;
 
-        // Check Zhonya's Hourglass
-        std::string zhonyas_buff = "zhonyasringshield";
-        auto zhonyas = target->get_buff_by_name(zhonyas_buff);
-        if (zhonyas && zhonyas->is_active())
-        {
-            info.is_in_stasis = true;
-            info.end_time = zhonyas->get_end_time();
-            info.exit_position = target->get_position();
-            info.stasis_type = "zhonyas";
-            return info;
-        }
-
-        // Check Guardian Angel
-        std::string ga_buff = "willrevive";
-        auto ga = target->get_buff_by_name(ga_buff);
-        if (ga && ga->is_active())
-        {
-            info.is_in_stasis = true;
-            info.end_time = ga->get_end_time();
-            info.exit_position = target->get_position();
-            info.stasis_type = "guardian_angel";
-            return info;
-        }
+        // Zhonya's Hourglass, Guardian Angel, Bard R, Lissandra R (self-cast)
+        struct StasisSource { NamedBuff buff; const char* type; };
+        constexpr StasisSource STASIS_SOURCES[] = {
+            { NamedBuff::zhonyas, "zhonyas" },
+            { NamedBuff::guardian_angel, "guardian_angel" },
+            { NamedBuff::bard_r, "bard_r" },
+            { NamedBuff::lissandra_r, "lissandra_r" }
+        };
 
-        // Check Bard R
-        std::string bard_buff = "bardrstasis";
-        auto bard_r = target->get_buff_by_name(bard_buff);
-        if (bard_r && bard_r->is_active())
+        for (const StasisSource& source : STASIS_SOURCES)
         {
-            info.is_in_stasis = true;
-            info.end_time = bard_r->get_end_time();
-            info.exit_position = target->get_position();
-            info.stasis_type = "bard_r";
-            return info;
-        }
+            if (!buffs.is_active(source.buff))
+                continue;
 
-        // Check Lissandra R (self-cast)
-        std::string liss_buff = "lissandrarstasis";
-        auto liss_r = target->get_buff_by_name(liss_buff);
-        if (liss_r && liss_r->is_active())
-        {
             info.is_in_stasis = true;
-            info.end_time = liss_r->get_end_time();
+            info.end_time = buffs.end_time(source.buff);
             info.exit_position = target->get_position();
-            info.stasis_type = "lissandra_r";
+            info.stasis_type = source.type;
             return info;
         }
 
         return info;
     }
 
+    inline StasisInfo detect_stasis(game_object* target)
+    {
+        return detect_stasis(target, capture_buff_state(target));
+    }
+
     /**
      * Calculate optimal cast timing for stasis exit
      * Returns: Time to wait before casting (0 = cast now, -1 = impossible)
@@ -249,7 +367,7 @@ namespace EdgeCases
     /**
      * Detect channeling or recall
      */
-    inline ChannelInfo detect_channel(game_object* target)
+    inline ChannelInfo detect_channel(game_object* target, const BuffState& buffs)
     {
         ChannelInfo info;
 
@@ -266,11 +384,9 @@ namespace EdgeCases
         info.is_recalling = is_recalling(target);
         if (info.is_recalling)
         {
-            std::string recall_buff_name = "recall";
-            auto recall_buff = target->get_buff_by_name(recall_buff_name);
-            if (recall_buff && recall_buff->is_active())
+            if (buffs.is_active(NamedBuff::recall))
             {
-                info.channel_end_time = recall_buff->get_end_time();
+                info.channel_end_time = buffs.end_time(NamedBuff::recall);
                 info.time_remaining = info.channel_end_time - current_time;
             }
             return info;
@@ -288,6 +404,11 @@ namespace EdgeCases
         return info;
     }
 
+    inline ChannelInfo detect_channel(game_object* target)
+    {
+        return detect_channel(target, capture_buff_state(target));
+    }
+
     /**
      * Check if we can interrupt channel before it completes
      */
@@ -309,13 +430,13 @@ namespace EdgeCases
     /**
      * Check if target is slowed
      */
-    inline bool is_slowed(game_object* target)
+    inline bool is_slowed(game_object* target, const BuffState& buffs)
     {
         if (!target || !target->is_valid())
             return false;
 
         // Method 1: Check for slow buff type
-        if (target->has_buff_of_type(buff_type::slow))
+        if (buffs.has_type(buff_type::slow))
             return true;
 
         // Method 2: Compare current vs base move speed
@@ -326,6 +447,11 @@ namespace EdgeCases
         return current_speed < base_speed * 0.95f;
     }
 
+    inline bool is_slowed(game_object* target)
+    {
+        return is_slowed(target, capture_buff_state(target));
+    }
+
     // =========================================================================
     // SPELL SHIELD DETECTION
     // =========================================================================
@@ -333,28 +459,23 @@ namespace EdgeCases
     /**
      * Check if target has spell shield active
      */
-    inline bool has_spell_shield(game_object* target)
+    inline bool has_spell_shield(game_object* target, const BuffState& buffs)
     {
         if (!target || !target->is_valid())
             return false;
 
         // Common spell shields
-        std::string banshees = "bansheesveil";
-        if (target->get_buff_by_name(banshees)) return true;
-
-        std::string sivir = "sivirshield";
-        if (target->get_buff_by_name(sivir)) return true;
-
-        std::string nocturne = "nocturneshroudofdarkness";
-        if (target->get_buff_by_name(nocturne)) return true;
-
-        std::string morgana = "morganablackshield";
-        if (target->get_buff_by_name(morgana)) return true;
+        constexpr uint16_t SPELL_SHIELD_MASK =
+            named_buff_bit(NamedBuff::banshees) | named_buff_bit(NamedBuff::sivir_shield) |
+            named_buff_bit(NamedBuff::nocturne_shroud) | named_buff_bit(NamedBuff::morgana_shield) |
+            named_buff_bit(NamedBuff::malzahar_shield);
 
-        std::string malzahar = "malzaharpassiveshield";
-        if (target->get_buff_by_name(malzahar)) return true;
+        return (buffs.named_mask & SPELL_SHIELD_MASK) != 0;
+    }
 
-        return false;
+    inline bool has_spell_shield(game_object* target)
+    {
+        return has_spell_shield(target, capture_buff_state(target));
     }
 
     // =========================================================================
@@ -371,7 +492,7 @@ namespace EdgeCases
         math::vector3 direction;      // Direction windwall is facing
         float width;
         float end_time;
-        std::string source_champion;  // "yasuo", "samira", "braum"
+        const char* source_champion;  // "yasuo", "samira", "braum" (string literal)
 
         WindwallInfo() : exists(false), position{}, direction{},
             width(0.f), end_time(0.f), source_champion("") {}
@@ -499,91 +620,28 @@ namespace EdgeCases
      * collides_with_minions: Whether this spell is blocked by minions
      *   - false for spells that pierce (Yasuo Q, Ezreal Q with Muramana, etc.)
      *   - true for spells that collide (Thresh Q, Blitz Q, Lux Q)
+     * target: skipped when the target itself is a minion (last hits, jungle clears)
      */
     inline float compute_minion_block_probability(
         const math::vector3& source_pos,
         const math::vector3& target_pos,
         float projectile_width,
-        bool collides_with_minions)
+        bool collides_with_minions,
+        const game_object* target = nullptr)
     {
-        // NOTE: Disabled due to SDK API compatibility
-        // get_enemy_minions() and get_ally_minions() may not exist in your SDK
-        // TODO: Update with correct SDK API once known
-        (void)source_pos;
-        (void)target_pos;
-        (void)projectile_width;
-        (void)collides_with_minions;
-        return 1.0f;  // No minion blocking detection for now
-
-        /* ORIGINAL CODE - DISABLED
         // If spell pierces minions, no collision
         if (!collides_with_minions)
             return 1.0f;
 
-        if (!g_sdk || !g_sdk->object_manager)
-            return 1.0f;
-
-        // Check distance threshold for both enemy and ally minions
+        // Check distance threshold
         constexpr float MIN_SAFE_DISTANCE = 1.0f;
-        math::vector3 to_target = target_pos - source_pos;
-        float distance_to_target = to_target.magnitude();
-
-        if (distance_to_target < MIN_SAFE_DISTANCE)
+        if (source_pos.distance(target_pos) < MIN_SAFE_DISTANCE)
             return 1.0f;  // Too close to worry about minions
 
-        math::vector3 direction = to_target / distance_to_target;
-
-        int blocking_minions = 0;
-
-        // Check enemy minions
-        auto enemy_minions = g_sdk->object_manager->get_enemy_minions();
-        for (auto* minion : enemy_minions)
-        {
-            if (!minion || !minion->is_valid())
-                continue;
-
-            // Check if minion is between source and target
-            math::vector3 to_minion = minion->get_position() - source_pos;
-            float distance_along_path = to_minion.dot(direction);
-
-            // Minion must be between source and target
-            if (distance_along_path < 0.f || distance_along_path > distance_to_target)
-                continue;
-
-            // Compute perpendicular distance from minion to projectile path
-            math::vector3 closest_point_on_path = source_pos + direction * distance_along_path;
-            float perpendicular_distance = (minion->get_position() - closest_point_on_path).magnitude();
-
-            // Check if minion hitbox overlaps projectile
-            float minion_radius = minion->get_bounding_radius();
-            if (perpendicular_distance < minion_radius + projectile_width)
-            {
-                blocking_minions++;
-            }
-        }
-
-        // Check ally minions too (they also block)
-        auto ally_minions = g_sdk->object_manager->get_ally_minions();
-        for (auto* minion : ally_minions)
-        {
-            if (!minion || !minion->is_valid())
-                continue;
-
-            math::vector3 to_minion = minion->get_position() - source_pos;
-            float distance_along_path = to_minion.dot(direction);
-
-            if (distance_along_path < 0.f || distance_along_path > distance_to_target)
-                continue;
-
-            math::vector3 closest_point_on_path = source_pos + direction * distance_along_path;
-            float perpendicular_distance = (minion->get_position() - closest_point_on_path).magnitude();
-
-            float minion_radius = minion->get_bounding_radius();
-            if (perpendicular_distance < minion_radius + projectile_width)
-            {
-                blocking_minions++;
-            }
-        }
+        // Enemy and ally minions both block; shared per-frame broad-phase grid
+        HybridPred::CollisionIndex::ensure_current();
+        int blocking_minions = HybridPred::CollisionIndex::count_blocking_units(
+            source_pos, target_pos, projectile_width, HybridPred::CollisionIndex::MASK_MINIONS, target);
 
         // Each minion blocks approximately 30% chance
         // Multiple minions: P(hit) = 0.7^n
@@ -594,8 +652,6 @@ namespace EdgeCases
             return 1.0f;
 
         return std::pow(0.7f, static_cast<float>(blocking_minions));
-        */
-        // END DISABLED CODE
     }
 
     // =========================================================================
@@ -606,7 +662,7 @@ namespace EdgeCases
      * Check if object is a clone (Shaco, Wukong, LeBlanc)
      * Returns true if it's a real champion, false if clone
      */
-    inline bool is_real_champion(game_object* obj)
+    inline bool is_real_champion(game_object* obj, const BuffState& buffs)
     {
         if (!obj || !obj->is_valid())
             return false;
@@ -619,36 +675,37 @@ namespace EdgeCases
         {
             // Real Shaco has different network ID than clone
             // Clone typically has "clone" in buff list
-            std::string shaco_buff = "shacopassive";
-            if (obj->get_buff_by_name(shaco_buff))
+            if (buffs.has(NamedBuff::shaco_clone))
                 return false;  // This is a clone
         }
 
         // Wukong clone detection
         if (name.find("monkeyking") != std::string::npos)
         {
-            std::string wukong_buff = "monkeykingdecoy";
-            if (obj->get_buff_by_name(wukong_buff))
+            if (buffs.has(NamedBuff::wukong_clone))
                 return false;  // This is a clone
         }
 
         // LeBlanc clone detection
         if (name.find("leblanc") != std::string::npos)
         {
-            std::string leblanc_buff = "leblancpassive";
-            if (obj->get_buff_by_name(leblanc_buff))
+            if (buffs.has(NamedBuff::leblanc_clone))
                 return false;  // This is a clone
         }
 
         // Neeko clone detection
-        std::string neeko_buff = "neekopassive";
-        if (obj->get_buff_by_name(neeko_buff))
+        if (buffs.has(NamedBuff::neeko_clone))
             return false;
 
         // Default: assume it's real
         return true;
     }
 
+    inline bool is_real_champion(game_object* obj)
+    {
+        return is_real_champion(obj, capture_buff_state(obj));
+    }
+
     // =========================================================================
     // COMBINED EDGE CASE ANALYSIS
     // =========================================================================
@@ -662,6 +719,7 @@ namespace EdgeCases
         DashInfo dash;
         ChannelInfo channel;
         std::vector<WindwallInfo> windwalls;
+        BuffState buffs;                // Buff pass the checks above were derived from
         bool is_slowed;
         bool has_shield;
         bool is_clone;
@@ -677,17 +735,21 @@ namespace EdgeCases
     };
 
     /**
-     * Analyze all edge cases for target
+     * Target-only edge cases (everything except source-dependent windwall blocking)
      */
-    inline EdgeCaseAnalysis analyze_target(game_object* target, game_object* source = nullptr)
+    inline EdgeCaseAnalysis analyze_target_state(
+        game_object* target,
+        const BuffState& buffs,
+        const std::vector<WindwallInfo>& windwalls)
     {
         EdgeCaseAnalysis analysis;
 
         if (!target || !target->is_valid())
             return analysis;
 
-        // Detect all edge cases
-        analysis.stasis = detect_stasis(target);
+        // Detect all edge cases (buff checks read the packed state)
+        analysis.buffs = buffs;
+        analysis.stasis = detect_stasis(target, buffs);
 
         // Dash prediction (configurable)
         if (PredictionConfig::get().enable_dash_prediction)
@@ -695,21 +757,11 @@ namespace EdgeCases
             analysis.dash = detect_dash(target);
         }
 
-        analysis.channel = detect_channel(target);
-        analysis.windwalls = detect_windwalls();
-        analysis.is_slowed = is_slowed(target);
-        analysis.has_shield = has_spell_shield(target);
-        analysis.is_clone = !is_real_champion(target);
-
-        // Check windwall blocking (only if source provided)
-        if (source && source->is_valid())
-        {
-            analysis.blocked_by_windwall = will_hit_windwall(
-                source->get_position(),
-                target->get_position(),
-                analysis.windwalls
-            );
-        }
+        analysis.channel = detect_channel(target, buffs);
+        analysis.windwalls = windwalls;
+        analysis.is_slowed = is_slowed(target, buffs);
+        analysis.has_shield = has_spell_shield(target, buffs);
+        analysis.is_clone = !is_real_champion(target, buffs);
 
         // Calculate adjustments
 
@@ -736,13 +788,144 @@ namespace EdgeCases
         if (analysis.has_shield)
             analysis.confidence_multiplier *= 0.5f;  // Spell will be blocked
 
-        if (analysis.blocked_by_windwall)
-            analysis.confidence_multiplier *= 0.2f;  // Will be blocked by windwall
-
         if (analysis.is_clone)
             analysis.priority_multiplier *= 0.1f;  // Don't target clones
 
         return analysis;
     }
 
+    // =========================================================================
+    // PER-FRAME SNAPSHOT
+    // =========================================================================
+
+    /**
+     * Frame-stamped edge case state
+     * Windwalls are detected once per frame; each target's buff lookups run on
+     * first use in a frame and are reused by every later prediction.
+     * Entries are flat (network id, state) lists: a frame sees at most a
+     * handful of champions, and clear() keeps their capacity for the next frame.
+     */
+    struct FrameSnapshot
+    {
+        float time = -1.f;
+        std::vector<WindwallInfo> windwalls;
+        std::vector<std::pair<uint32_t, EdgeCaseAnalysis>> targets;   // network id -> target-only analysis
+        std::vector<std::pair<uint32_t, BuffState>> buffs;            // network id -> buff pass
+
+        template<typename Entries>
+        static auto find(Entries& entries, uint32_t network_id)
+        {
+            return std::find_if(entries.begin(), entries.end(),
+                [network_id](const auto& entry) { return entry.first == network_id; });
+        }
+    };
+
+    inline FrameSnapshot& frame_snapshot()
+    {
+        static FrameSnapshot snapshot;
+        return snapshot;
+    }
+
+    /**
+     * Start a new snapshot if the game clock advanced (no-op within a frame)
+     */
+    inline void begin_frame(float current_time)
+    {
+        FrameSnapshot& snapshot = frame_snapshot();
+        if (snapshot.time == current_time)
+            return;
+
+        snapshot.time = current_time;
+        snapshot.targets.clear();
+        snapshot.buffs.clear();
+        snapshot.windwalls = detect_windwalls();
+    }
+
+    /**
+     * Buff state for target, captured at most once per frame
+     * Shared by TargetBehaviorTracker sampling and analyze_target.
+     */
+    inline BuffState get_frame_buff_state(game_object* target)
+    {
+        if (!target || !target->is_valid())
+            return BuffState{};
+
+        if (!PredictionConfig::get().enable_edge_case_snapshot || !g_sdk || !g_sdk->clock_facade)
+            return capture_buff_state(target);
+
+        begin_frame(g_sdk->clock_facade->get_game_time());
+
+        FrameSnapshot& snapshot = frame_snapshot();
+        uint32_t network_id = target->get_network_id();
+
+        auto it = FrameSnapshot::find(snapshot.buffs, network_id);
+        if (it != snapshot.buffs.end())
+            return it->second;
+
+        snapshot.buffs.emplace_back(network_id, capture_buff_state(target));
+        return snapshot.buffs.back().second;
+    }
+
+    /**
+     * Drop snapshot state (plugin unload / tracker reset)
+     */
+    inline void clear_frame_snapshot()
+    {
+        FrameSnapshot& snapshot = frame_snapshot();
+        snapshot.time = -1.f;
+        snapshot.targets.clear();
+        snapshot.buffs.clear();
+        snapshot.windwalls.clear();
+    }
+
+    /**
+     * Analyze all edge cases for target
+     */
+    inline EdgeCaseAnalysis analyze_target(game_object* target, game_object* source = nullptr)
+    {
+        if (!target || !target->is_valid())
+            return EdgeCaseAnalysis{};
+
+        EdgeCaseAnalysis analysis;
+
+        if (PredictionConfig::get().enable_edge_case_snapshot && g_sdk && g_sdk->clock_facade)
+        {
+            begin_frame(g_sdk->clock_facade->get_game_time());
+
+            FrameSnapshot& snapshot = frame_snapshot();
+            uint32_t network_id = target->get_network_id();
+
+            auto it = FrameSnapshot::find(snapshot.targets, network_id);
+            if (it != snapshot.targets.end())
+            {
+                analysis = it->second;
+            }
+            else
+            {
+                BuffState buffs = get_frame_buff_state(target);
+                snapshot.targets.emplace_back(network_id, analyze_target_state(target, buffs, snapshot.windwalls));
+                analysis = snapshot.targets.back().second;
+            }
+        }
+        else
+        {
+            analysis = analyze_target_state(target, capture_buff_state(target), detect_windwalls());
+        }
+
+        // Check windwall blocking (only if source provided)
+        if (source && source->is_valid())
+        {
+            analysis.blocked_by_windwall = will_hit_windwall(
+                source->get_position(),
+                target->get_position(),
+                analysis.windwalls
+            );
+        }
+
+        if (analysis.blocked_by_windwall)
+            analysis.confidence_multiplier *= 0.2f;  // Will be blocked by windwall
+
+        return analysis;
+    }
+
 } // namespace EdgeCases
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// Heap allocation counter: Set to 1 to count every operator new in the module
+// (replacement operators live in HybridPrediction.cpp). Defaults on in debug builds.
+#ifndef HYBRID_PRED_COUNT_ALLOCATIONS
+    #if defined(_DEBUG)
+        #define HYBRID_PRED_COUNT_ALLOCATIONS 1
+    #else
+        #define HYBRID_PRED_COUNT_ALLOCATIONS 0
+    #endif
+#endif
+
+/**
+ * =============================================================================
+ * PER-FRAME ARENA
+ * =============================================================================
+ *
+ * Bump allocator for prediction temporaries (reachable region boundary,
+ * optimizer frontiers, AoE seeds). PredictionManager::update() rewinds it at
+ * the start of every game_update, so nothing allocated here may outlive the
+ * frame. Deallocation is a no-op. Game thread only (the PDF worker never
+ * touches it).
+ *
+ * A frame that outgrows the block spills into heap overflow chunks; the next
+ * reset() replaces block + chunks with one block of the combined size, so the
+ * steady state performs no general-heap allocations.
+ *
+ * Containers opt in explicitly: FrameAllocator<T>::frame() allocates from the
+ * arena, a default-constructed FrameAllocator uses the general heap. Copies of
+ * a FrameVector always use the heap (select_on_container_copy_construction),
+ * so results copied out of the pipeline (debug payloads) stay valid.
+ *
+ * Usage:
+ *   FrameVector<math::vector3> points(FrameAllocator<math::vector3>::frame());
+ *   points.reserve(32);
+ *
+ * With HYBRID_PRED_COUNT_ALLOCATIONS, HeapScope counts operator new calls made
+ * inside HybridFusionEngine::compute_hybrid_prediction (FrameArena::get_stats).
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+    class FrameArena
+    {
+    public:
+        static constexpr size_t INITIAL_BLOCK_SIZE = 64 * 1024;
+
+        struct Stats
+        {
+            size_t block_size = 0;               // Current primary block
+            size_t frame_bytes = 0;              // Bytes handed out last frame (incl. overflow)
+            size_t peak_bytes = 0;
+            uint64_t overflow_chunks = 0;        // Heap spills (block grown at the next reset)
+            uint64_t prediction_heap_allocations = 0;   // HYBRID_PRED_COUNT_ALLOCATIONS only
+        };
+
+        /**
+         * Rewind the arena (call at the start of every game_update)
+         * Invalidates everything allocated since the previous reset
+         */
+        static void reset()
+        {
+            State& arena = state();
+            size_t used = arena.offset + arena.overflow_bytes;
+            arena.stats.frame_bytes = used;
+            if (used > arena.stats.peak_bytes)
+                arena.stats.peak_bytes = used;
+
+            // Fold overflow into one larger block so the next frame fits
+            if (!arena.overflow.empty())
+            {
+                size_t size = arena.size;
+                while (size < used)
+                    size *= 2;
+
+                arena.overflow.clear();
+                arena.block.reset();
+                arena.size = size;
+            }
+
+            arena.overflow_bytes = 0;
+            arena.offset = 0;
+        }
+
+        static void* allocate(size_t bytes, size_t alignment)
+        {
+            State& arena = state();
+            if (!arena.block)
+            {
+                arena.block.reset(new std::byte[arena.size]);
+                arena.stats.block_size = arena.size;
+            }
+
+            size_t start = (arena.offset + alignment - 1) & ~(alignment - 1);
+            if (start + bytes <= arena.size)
+            {
+                arena.offset = start + bytes;
+                return arena.block.get() + start;
+            }
+
+            // Spill: dedicated chunk (operator new[] aligns to max_align_t)
+            ++arena.stats.overflow_chunks;
+            arena.overflow_bytes += bytes;
+            arena.overflow.emplace_back(new std::byte[bytes + alignment]);
+            auto address = reinterpret_cast<uintptr_t>(arena.overflow.back().get());
+            return reinterpret_cast<void*>((address + alignment - 1) & ~(uintptr_t{ alignment } - 1));
+        }
+
+        static const Stats& get_stats() { return state().stats; }
+
+        /**
+         * Free all arena memory (plugin unload)
+         */
+        static void release()
+        {
+            State& arena = state();
+            arena.block.reset();
+            arena.overflow.clear();
+            arena.overflow.shrink_to_fit();
+            arena.size = INITIAL_BLOCK_SIZE;
+            arena.offset = 0;
+            arena.overflow_bytes = 0;
+        }
+
+#if HYBRID_PRED_COUNT_ALLOCATIONS
+        // operator new calls on this thread (incremented by the replacement operators)
+        static inline thread_local uint64_t heap_allocation_count = 0;
+#endif
+
+        /**
+         * Adds the heap allocations made during its lifetime to
+         * Stats::prediction_heap_allocations (outermost scope only)
+         */
+        class HeapScope
+        {
+        public:
+#if HYBRID_PRED_COUNT_ALLOCATIONS
+            HeapScope() : start_(heap_allocation_count), outermost_(depth()++ == 0) {}
+
+            ~HeapScope()
+            {
+                --depth();
+                if (outermost_)
+                    state().stats.prediction_heap_allocations += heap_allocation_count - start_;
+            }
+
+        private:
+            static int& depth()
+            {
+                static thread_local int value = 0;
+                return value;
+            }
+
+            uint64_t start_;
+            bool outermost_;
+#endif
+        };
+
+    private:
+        struct State
+        {
+            std::unique_ptr<std::byte[]> block;
+            size_t size = INITIAL_BLOCK_SIZE;
+            size_t offset = 0;
+            size_t overflow_bytes = 0;
+            std::vector<std::unique_ptr<std::byte[]>> overflow;
+            Stats stats;
+        };
+
+        static State& state()
+        {
+            static State instance;
+            return instance;
+        }
+    };
+
+    /**
+     * Allocator over FrameArena (frame()) or the general heap (default)
+     */
+    template<typename T>
+    class FrameAllocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        FrameAllocator() noexcept = default;
+
+        template<typename U>
+        FrameAllocator(const FrameAllocator<U>& other) noexcept : use_arena_(other.uses_arena()) {}
+
+        static FrameAllocator frame() noexcept
+        {
+            FrameAllocator allocator;
+            allocator.use_arena_ = true;
+            return allocator;
+        }
+
+        bool uses_arena() const noexcept { return use_arena_; }
+
+        T* allocate(size_t count)
+        {
+            if (use_arena_)
+                return static_cast<T*>(FrameArena::allocate(count * sizeof(T), alignof(T)));
+            return std::allocator<T>().allocate(count);
+        }
+
+        void deallocate(T* pointer, size_t count) noexcept
+        {
+            if (!use_arena_)
+                std::allocator<T>().deallocate(pointer, count);
+        }
+
+        // Copies may outlive the frame: give them heap storage
+        FrameAllocator select_on_container_copy_construction() const noexcept { return FrameAllocator{}; }
+
+        template<typename U>
+        bool operator==(const FrameAllocator<U>& other) const noexcept { return use_arena_ == other.uses_arena(); }
+
+        template<typename U>
+        bool operator!=(const FrameAllocator<U>& other) const noexcept { return !(*this == other); }
+
+    private:
+        bool use_arena_ = false;
+    };
+
+    template<typename T>
+    using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+} // namespace HybridPred
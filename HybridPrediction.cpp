@@ -6,17 +6,385 @@
 
 #include "HybridPrediction.h"
 #include "EdgeCaseDetection.h"
+#include "PredictionSIMD.h"
+#include "PredictionTables.h"
+#include "PredictionProfiler.h"
+#include "PredictionTrace.h"
+#include "NavGrid.h"
+#include "PredictionWorker.h"
+#include "ProfileStore.h"
+#include "PredictionTelemetry.h"
+#include "PredictionBudget.h"
 #include <cmath>
 #include <cfloat>
+#include <ctime>
 #include <algorithm>
 #include <sstream>
+#if HYBRID_PRED_COUNT_ALLOCATIONS
+    #include <cstdlib>
+#endif
 
 // Reasoning string generation (expensive - disable for production)
 // Set to 0 to disable reasoning strings (saves ~0.02ms per prediction)
+// Strings land in HybridPredictionResult::debug, so enable_prediction_debug must also be set
 #define HYBRID_PRED_ENABLE_REASONING 0
 
 namespace HybridPred
 {
+    namespace
+    {
+        template<int N, int SPIRAL_FACTOR>
+        SIMD::DiskSampleTable make_disk_table(const Tables::FermatSpiral<N, SPIRAL_FACTOR>& spiral)
+        {
+            return { spiral.radius_scale, spiral.cos_theta, spiral.sin_theta, N };
+        }
+
+        /**
+         * Compile-time sample counts of one pipeline quality tier
+         * The shape pipelines are instantiated per tier; PredictionBudget picks one per call
+         */
+        template<QualityTier TIER>
+        struct TierParams;
+
+        template<>
+        struct TierParams<QualityTier::full>
+        {
+            static constexpr int GRID_SEARCH_SIZE = 16;                                 // Circular cast grid per axis
+            static constexpr int GRADIENT_ITERATIONS = 2;
+            static constexpr int EVALUATION_DIVISOR = 1;                                // Branch-and-bound budget share
+            static constexpr const auto& SPIRAL = Tables::REACHABILITY_SPIRAL;          // 128 samples
+            static constexpr const auto& BOUNDARY = Tables::BOUNDARY_CIRCLE;            // 32 rays
+            static constexpr const auto& GRADIENT = Tables::GRADIENT_DIRECTIONS;        // 8 probes
+            static constexpr const auto& ORIENTATIONS = Tables::VECTOR_ORIENTATIONS;    // 20 lines
+        };
+
+        template<>
+        struct TierParams<QualityTier::reduced>
+        {
+            static constexpr int GRID_SEARCH_SIZE = 10;
+            static constexpr int GRADIENT_ITERATIONS = 1;
+            static constexpr int EVALUATION_DIVISOR = 2;
+            static constexpr const auto& SPIRAL = Tables::REACHABILITY_SPIRAL_REDUCED;
+            static constexpr const auto& BOUNDARY = Tables::BOUNDARY_CIRCLE_REDUCED;
+            static constexpr const auto& GRADIENT = Tables::GRADIENT_DIRECTIONS;
+            static constexpr const auto& ORIENTATIONS = Tables::VECTOR_ORIENTATIONS_REDUCED;
+        };
+
+        template<>
+        struct TierParams<QualityTier::minimal>
+        {
+            static constexpr int GRID_SEARCH_SIZE = 6;
+            static constexpr int GRADIENT_ITERATIONS = 1;
+            static constexpr int EVALUATION_DIVISOR = 4;
+            static constexpr const auto& SPIRAL = Tables::REACHABILITY_SPIRAL_MINIMAL;
+            static constexpr const auto& BOUNDARY = Tables::BOUNDARY_CIRCLE_MINIMAL;
+            static constexpr const auto& GRADIENT = Tables::GRADIENT_DIRECTIONS_MINIMAL;
+            static constexpr const auto& ORIENTATIONS = Tables::VECTOR_ORIENTATIONS_MINIMAL;
+        };
+
+        /**
+         * Debug payload for result (nullptr unless PredictionConfig enables it)
+         */
+        HybridPredictionDebug* attach_debug(HybridPredictionResult& result)
+        {
+            if (!PredictionConfig::get().enable_prediction_debug)
+                return nullptr;
+
+            if (!result.debug)
+                result.debug = std::make_shared<HybridPredictionDebug>();
+            return result.debug.get();
+        }
+
+        /**
+         * Fraction of a wall-clipped reachable region inside a shape
+         * Spiral samples over the full disc, restricted to those the clipped region contains
+         */
+        template<QualityTier TIER, typename InShape>
+        float clipped_region_overlap(const ReachableRegion& region, InShape&& in_shape)
+        {
+            const auto& spiral = TierParams<TIER>::SPIRAL;
+            int reachable = 0;
+            int hits = 0;
+            for (int i = 0; i < spiral.SAMPLES; ++i)
+            {
+                math::vector3 point = region.center;
+                float r = region.max_radius * spiral.radius_scale[i];
+                point.x += r * spiral.cos_theta[i];
+                point.z += r * spiral.sin_theta[i];
+                if (!region.contains(point))
+                    continue;
+
+                ++reachable;
+                if (in_shape(point))
+                    ++hits;
+            }
+
+            return reachable > 0 ? static_cast<float>(hits) / reachable : 0.f;
+        }
+
+        /**
+         * Area of disk ∩ shape by Green's theorem over the intersection boundary
+         *
+         * The shape boundary is added as a closed counter-clockwise loop (x toward z)
+         * of segments and circular arcs. Each piece is clipped to the disk and
+         * contributes its closed-form (x dz - z dx) / 2 term; the disk circle
+         * contributes the arcs between boundary crossings whose midpoint lies in
+         * the shape, so the shape does not need to be convex.
+         * Coordinates are relative to the disk center.
+         */
+        class DiskOverlap
+        {
+        public:
+            explicit DiskOverlap(float radius) : radius_(radius) {}
+
+            void add_segment(float ax, float az, float bx, float bz)
+            {
+                // |a + t (b - a)|² <= r²
+                float dx = bx - ax;
+                float dz = bz - az;
+                float qa = dx * dx + dz * dz;
+                if (qa < EPSILON)
+                    return;
+
+                float qb = ax * dx + az * dz;
+                float qc = ax * ax + az * az - radius_ * radius_;
+                float discriminant = qb * qb - qa * qc;
+                if (discriminant <= 0.f)
+                    return;
+
+                float root = std::sqrt(discriminant);
+                float t0 = (-qb - root) / qa;
+                float t1 = (-qb + root) / qa;
+                if (t0 > 0.f && t0 < 1.f)
+                    add_crossing(ax + dx * t0, az + dz * t0);
+                if (t1 > 0.f && t1 < 1.f)
+                    add_crossing(ax + dx * t1, az + dz * t1);
+
+                float lo = std::max(t0, 0.f);
+                float hi = std::min(t1, 1.f);
+                if (lo >= hi)
+                    return;
+
+                float px = ax + dx * lo, pz = az + dz * lo;
+                float qx = ax + dx * hi, qz = az + dz * hi;
+                area_ += 0.5 * (px * qz - pz * qx);
+            }
+
+            // Arc of circle (cx, cz, arc_radius) from angle_from to angle_to (CCW, span <= 2 pi)
+            void add_arc(float cx, float cz, float arc_radius, float angle_from, float angle_to)
+            {
+                float offset = std::sqrt(cx * cx + cz * cz);
+                if (offset < EPSILON)
+                {
+                    // Concentric: all or nothing
+                    if (arc_radius <= radius_)
+                        add_arc_term(cx, cz, arc_radius, angle_from, angle_to);
+                    return;
+                }
+
+                // Inside the disk <=> cos(t - phi) <= k (phi = direction of the arc center)
+                float k = (radius_ * radius_ - offset * offset - arc_radius * arc_radius) / (2.f * arc_radius * offset);
+                if (k >= 1.f)
+                {
+                    add_arc_term(cx, cz, arc_radius, angle_from, angle_to);
+                    return;
+                }
+                if (k <= -1.f)
+                    return;
+
+                float phi = std::atan2(cz, cx);
+                float gap = std::acos(k);
+                constexpr float TWO_PI = 2.f * PI;
+
+                // Inside interval [phi + gap, phi + 2 pi - gap], shifted to start at or before angle_from
+                float start = phi + gap;
+                start -= TWO_PI * std::ceil((start - angle_from) / TWO_PI);
+                float width = TWO_PI - 2.f * gap;
+
+                for (int wrap = 0; wrap < 2; ++wrap)
+                {
+                    float lo = std::max(angle_from, start + wrap * TWO_PI);
+                    float hi = std::min(angle_to, start + wrap * TWO_PI + width);
+                    if (lo < hi)
+                        add_arc_term(cx, cz, arc_radius, lo, hi);
+                }
+
+                // Crossings at t = phi ± gap inside the open arc
+                for (float t : { phi + gap, phi - gap })
+                {
+                    t -= TWO_PI * std::floor((t - angle_from) / TWO_PI);
+                    if (t > angle_from && t < angle_to)
+                        add_crossing(cx + arc_radius * std::cos(t), cz + arc_radius * std::sin(t));
+                }
+            }
+
+            template<typename InShape>
+            float area(InShape&& in_shape)
+            {
+                // Disk circle: whole, or the arcs between crossings that lie in the shape
+                if (crossing_count_ == 0)
+                {
+                    if (in_shape(radius_, 0.f))
+                        area_ += PI * radius_ * radius_;
+                }
+                else
+                {
+                    std::sort(crossings_, crossings_ + crossing_count_);
+                    for (int i = 0; i < crossing_count_; ++i)
+                    {
+                        float from = crossings_[i];
+                        float to = i + 1 < crossing_count_ ? crossings_[i + 1] : crossings_[0] + 2.f * PI;
+                        float middle = 0.5f * (from + to);
+                        if (to > from && in_shape(radius_ * std::cos(middle), radius_ * std::sin(middle)))
+                            area_ += 0.5 * radius_ * radius_ * (to - from);
+                    }
+                }
+
+                return static_cast<float>(std::max(area_, 0.0));
+            }
+
+        private:
+            static constexpr int MAX_CROSSINGS = 16;
+
+            void add_crossing(float x, float z)
+            {
+                if (crossing_count_ < MAX_CROSSINGS)
+                    crossings_[crossing_count_++] = std::atan2(z, x);
+            }
+
+            // ∫ (x dz - z dx) / 2 along (cx, cz) + r (cos t, sin t), t in [from, to]
+            void add_arc_term(float cx, float cz, float r, float from, float to)
+            {
+                area_ += 0.5 * (r * r * (to - from) +
+                    r * (cx * (std::sin(to) - std::sin(from)) - cz * (std::cos(to) - std::cos(from))));
+            }
+
+            float radius_;
+            double area_ = 0.0;
+            float crossings_[MAX_CROSSINGS];
+            int crossing_count_ = 0;
+        };
+
+        SIMD::ConeParams make_cone_params(const math::vector3& cone_origin, const math::vector3& cone_direction,
+            float cone_half_angle, float cone_range)
+        {
+            SIMD::ConeParams cone;
+            cone.origin_x = cone_origin.x;
+            cone.origin_z = cone_origin.z;
+            cone.dir_x = cone_direction.x;
+            cone.dir_z = cone_direction.z;
+            cone.cos_half_angle = std::cos(cone_half_angle);
+            cone.range_sq = cone_range * cone_range;
+            return cone;
+        }
+
+        /**
+         * Orientation histogram for lines centered on a fixed point
+         *
+         * Each point covers one arc of orientations (SIMD::centered_line_arcs), and
+         * a difference array turns all arcs into per-bin mass in one pass.
+         * Bin b holds the mass inside the line at theta = b * pi / BINS, so every
+         * tier's orientation table angle is a bin center. With arcs from a widened
+         * line, each bin bounds the mass inside the exact line from above.
+         */
+        struct OrientationHistogram
+        {
+            static constexpr int BINS = 60;                  // Over [0, pi): 3 degree brackets
+            static constexpr float BIN_WIDTH = PI / BINS;
+            static constexpr float INV_BIN_WIDTH = BINS / PI;
+
+            float base = 0.f;                                // Mass inside every orientation
+            float diff[BINS + 1] = {};
+
+            // Table orientations (and their theta + pi flips) must land on bin centers
+            static_assert((2 * BINS) % TierParams<QualityTier::full>::ORIENTATIONS.SAMPLES == 0);
+            static_assert((2 * BINS) % TierParams<QualityTier::reduced>::ORIENTATIONS.SAMPLES == 0);
+            static_assert((2 * BINS) % TierParams<QualityTier::minimal>::ORIENTATIONS.SAMPLES == 0);
+
+            void add(float phi, float half_arc, float weight)
+            {
+                if (half_arc < 0.f)
+                    return;
+                if (half_arc >= PI * 0.5f)
+                {
+                    base += weight;
+                    return;
+                }
+
+                // First / last bin center inside [phi - half_arc, phi + half_arc]; both stay
+                // within (-BINS, 2 * BINS), so offset casts act as floor / ceil
+                int lo = BINS - static_cast<int>(BINS - (phi - half_arc) * INV_BIN_WIDTH);
+                int hi = static_cast<int>((phi + half_arc) * INV_BIN_WIDTH + BINS) - BINS;
+                if (hi < lo)
+                    return;
+                if (hi - lo + 1 >= BINS)
+                {
+                    base += weight;
+                    return;
+                }
+
+                if (lo < 0)
+                {
+                    lo += BINS;
+                    hi += BINS;
+                }
+
+                diff[lo] += weight;
+                if (hi < BINS)
+                {
+                    diff[hi + 1] -= weight;
+                }
+                else
+                {
+                    diff[BINS] -= weight;
+                    diff[0] += weight;
+                    diff[hi - BINS + 1] -= weight;
+                }
+            }
+
+            void add(const float* phi, const float* half_arc, const float* weight, int count)
+            {
+                for (int i = 0; i < count; ++i)
+                    add(phi[i], half_arc[i], weight[i]);
+            }
+
+            void add(const float* phi, const float* half_arc, float weight, int count)
+            {
+                for (int i = 0; i < count; ++i)
+                    add(phi[i], half_arc[i], weight);
+            }
+
+            // Per-bin mass (prefix sum of the difference array)
+            void resolve(float* mass) const
+            {
+                float running = base;
+                for (int b = 0; b < BINS; ++b)
+                {
+                    running += diff[b];
+                    mass[b] = running;
+                }
+            }
+        };
+
+        /**
+         * Area of a disk inside a band of the given half-width whose center line
+         * passes offset from the disk center
+         */
+        float disk_band_area(float radius, float offset, float half_width)
+        {
+            // Disk area on the near side of a chord at signed distance t from the center
+            auto below = [radius](float t)
+            {
+                if (t <= -radius)
+                    return 0.f;
+                if (t >= radius)
+                    return PI * radius * radius;
+                return radius * radius * (PI - std::acos(t / radius)) + t * std::sqrt(radius * radius - t * t);
+            };
+            return below(offset + half_width) - below(offset - half_width);
+        }
+    }
+
     // =========================================================================
     // BEHAVIOR PDF IMPLEMENTATION
     // =========================================================================
@@ -50,217 +418,739 @@ namespace HybridPred
         return v0 * (1.f - fz) + v1 * fz;
     }
 
-    void BehaviorPDF::normalize()
+    void BehaviorPDF::clear()
     {
+        for (int x = active_x_first; x <= active_x_last; ++x)
+            std::fill(&pdf_grid[x][active_z_first], &pdf_grid[x][active_z_last] + 1, 0.f);
+
+        active_x_first = GRID_SIZE;
+        active_x_last = -1;
+        active_z_first = GRID_SIZE;
+        active_z_last = -1;
         total_probability = 0.f;
+    }
 
-        // Sum all probabilities
-        for (int i = 0; i < GRID_SIZE; ++i)
+    void BehaviorPDF::fit_active_box()
+    {
+        int x_first = GRID_SIZE, x_last = -1;
+        int z_first = GRID_SIZE, z_last = -1;
+
+        for (int x = active_x_first; x <= active_x_last; ++x)
         {
-            for (int j = 0; j < GRID_SIZE; ++j)
+            for (int z = active_z_first; z <= active_z_last; ++z)
             {
-                total_probability += pdf_grid[i][j];
+                if (pdf_grid[x][z] == 0.f)
+                    continue;
+
+                x_first = std::min(x_first, x);
+                x_last = x;
+                z_first = std::min(z_first, z);
+                z_last = std::max(z_last, z);
             }
         }
 
+        active_x_first = x_first;
+        active_x_last = x_last;
+        active_z_first = z_first;
+        active_z_last = z_last;
+    }
+
+    void BehaviorPDF::normalize()
+    {
+        fit_active_box();
+
+        total_probability = 0.f;
+        if (!has_active_cells())
+            return;
+
+        // Box rows are contiguous in z: reduce/scale one span per row
+        int columns = active_z_last - active_z_first + 1;
+
+        // Sum all probabilities
+        for (int x = active_x_first; x <= active_x_last; ++x)
+            total_probability += SIMD::sum(&pdf_grid[x][active_z_first], columns);
+
         // Normalize so sum = 1
         if (total_probability > EPSILON)
         {
             float scale = 1.f / total_probability;
-            for (int i = 0; i < GRID_SIZE; ++i)
+            for (int x = active_x_first; x <= active_x_last; ++x)
+                SIMD::scale(&pdf_grid[x][active_z_first], columns, scale);
+            total_probability = 1.f;
+        }
+
+        // Rebuild summed-area table over the active box (queries never leave it)
+        for (int j = active_z_first; j <= active_z_last + 1; ++j)
+            sat_grid[active_x_first][j] = 0.f;
+
+        for (int i = active_x_first; i <= active_x_last; ++i)
+        {
+            float row_sum = 0.f;
+            sat_grid[i + 1][active_z_first] = 0.f;
+            for (int j = active_z_first; j <= active_z_last; ++j)
             {
-                for (int j = 0; j < GRID_SIZE; ++j)
-                {
-                    pdf_grid[i][j] *= scale;
-                }
+                row_sum += pdf_grid[i][j];
+                sat_grid[i + 1][j + 1] = sat_grid[i][j + 1] + row_sum;
             }
-            total_probability = 1.f;
         }
     }
 
-    void BehaviorPDF::add_weighted_sample(const math::vector3& pos, float weight)
+    bool BehaviorPDF::cell_range(float origin_axis, float lo, float hi, int axis_first, int axis_last,
+        int& first, int& last) const
     {
-        // Convert world position to grid coordinates
-        float dx = pos.x - origin.x;
-        float dz = pos.z - origin.z;
+        // Cell k covers center c(k) = origin + (k - GRID_SIZE/2 + 0.5) * cell_size
+        // c(k) in [lo, hi]  <=>  k in [(lo - origin)/cell_size + GRID_SIZE/2 - 0.5, ...]
+        constexpr float HALF_GRID = GRID_SIZE / 2 - 0.5f;
+        float inv_cell = 1.f / cell_size;
 
-        int grid_x = static_cast<int>((dx / cell_size) + GRID_SIZE / 2);
-        int grid_z = static_cast<int>((dz / cell_size) + GRID_SIZE / 2);
+        float k_lo = std::ceil((lo - origin_axis) * inv_cell + HALF_GRID);
+        float k_hi = std::floor((hi - origin_axis) * inv_cell + HALF_GRID);
 
-        // Gaussian kernel (spread probability to nearby cells)
-        constexpr float sigma = 1.5f;
-        constexpr int kernel_radius = 2;
+        // Clamp in float space first (interval may be far outside the grid)
+        k_lo = std::max(k_lo, static_cast<float>(axis_first));
+        k_hi = std::min(k_hi, static_cast<float>(axis_last));
 
-        for (int i = -kernel_radius; i <= kernel_radius; ++i)
-        {
-            for (int j = -kernel_radius; j <= kernel_radius; ++j)
-            {
-                int gx = grid_x + i;
-                int gz = grid_z + j;
+        if (k_lo > k_hi)
+            return false;
 
-                if (gx >= 0 && gx < GRID_SIZE && gz >= 0 && gz < GRID_SIZE)
-                {
-                    float dist_sq = static_cast<float>(i * i + j * j);
-                    float kernel_value = std::exp(-dist_sq / (2.f * sigma * sigma));
-                    pdf_grid[gx][gz] += weight * kernel_value;
-                }
-            }
-        }
+        first = static_cast<int>(k_lo);
+        last = static_cast<int>(k_hi);
+        return true;
     }
 
-    // =========================================================================
-    // TARGET BEHAVIOR TRACKER IMPLEMENTATION
-    // =========================================================================
+    float BehaviorPDF::row_span_probability(int x, int z_first, int z_last) const
+    {
+        return sat_grid[x + 1][z_last + 1] - sat_grid[x][z_last + 1]
+            - sat_grid[x + 1][z_first] + sat_grid[x][z_first];
+    }
 
-    TargetBehaviorTracker::TargetBehaviorTracker(game_object* target)
-        : target_(target), last_update_time_(0.f), last_aa_time_(0.f),
-        cached_prediction_time_(-1.f), cached_move_speed_(-1.f), cached_timestamp_(-1.f)
+    float BehaviorPDF::rect_probability(float min_x, float min_z, float max_x, float max_z) const
     {
+        int x_first, x_last, z_first, z_last;
+        if (!cell_range(origin.x, min_x, max_x, active_x_first, active_x_last, x_first, x_last) ||
+            !cell_range(origin.z, min_z, max_z, active_z_first, active_z_last, z_first, z_last))
+            return 0.f;
+
+        float prob = sat_grid[x_last + 1][z_last + 1] - sat_grid[x_first][z_last + 1]
+            - sat_grid[x_last + 1][z_first] + sat_grid[x_first][z_first];
+        return std::max(prob, 0.f);
     }
 
-    void TargetBehaviorTracker::update()
+    float BehaviorPDF::circle_probability(const math::vector3& center, float radius) const
     {
-        if (!target_ || !target_->is_valid())
-            return;
+        if (radius <= 0.f)
+            return 0.f;
 
-        float current_time = g_sdk->clock_facade->get_game_time();
+        int x_first, x_last;
+        if (!cell_range(origin.x, center.x - radius, center.x + radius, active_x_first, active_x_last, x_first, x_last))
+            return 0.f;
 
-        // Sample at fixed rate
-        if (current_time - last_update_time_ < MOVEMENT_SAMPLE_RATE)
-            return;
+        float radius_sq = radius * radius;
+        float prob = 0.f;
 
-        // Create snapshot
-        MovementSnapshot snapshot;
-        snapshot.position = target_->get_position();
-        snapshot.timestamp = current_time;
+        for (int x = x_first; x <= x_last; ++x)
+        {
+            // Chord of the circle along this row's cell-center line
+            float dx = cell_center(origin.x, x) - center.x;
+            float chord_sq = radius_sq - dx * dx;
+            if (chord_sq < 0.f)
+                continue;
 
-        snapshot.is_auto_attacking = is_auto_attacking(target_);
-        snapshot.is_casting = is_casting_spell(target_);
-        snapshot.is_dashing = target_->is_dashing();
-        snapshot.is_cced = target_->has_buff_of_type(buff_type::stun) || target_->has_buff_of_type(buff_type::charm) ||
-            target_->has_buff_of_type(buff_type::fear) || target_->has_buff_of_type(buff_type::snare) || target_->has_buff_of_type(buff_type::taunt) ||
-            target_->has_buff_of_type(buff_type::suppression) || target_->has_buff_of_type(buff_type::knockup);
+            float half_chord = std::sqrt(chord_sq);
 
-        // Safety: Prevent division by zero
-        float max_hp = target_->get_max_hp();
-        snapshot.hp_percent = (max_hp > 0.f) ? (target_->get_hp() / max_hp) * 100.f : 100.f;
+            int z_first, z_last;
+            if (cell_range(origin.z, center.z - half_chord, center.z + half_chord,
+                active_z_first, active_z_last, z_first, z_last))
+                prob += row_span_probability(x, z_first, z_last);
+        }
 
-        // Compute velocity if we have previous snapshot
-        if (!movement_history_.empty())
+        return std::max(prob, 0.f);
+    }
+
+    float BehaviorPDF::strip_probability(
+        const math::vector3& start,
+        const math::vector3& direction,
+        float length,
+        float half_width) const
+    {
+        if (half_width <= 0.f)
+            return 0.f;
+
+        // Work in XZ only (matches point_in_capsule)
+        float dir_len = std::sqrt(direction.x * direction.x + direction.z * direction.z);
+        if (length < EPSILON || dir_len < EPSILON)
+            return circle_probability(start, half_width);
+
+        float dx = direction.x / dir_len;
+        float dz = direction.z / dir_len;
+        float end_x = start.x + dx * length;
+        float end_z = start.z + dz * length;
+
+        int x_first, x_last;
+        if (!cell_range(origin.x,
+            std::min(start.x, end_x) - half_width,
+            std::max(start.x, end_x) + half_width,
+            active_x_first, active_x_last, x_first, x_last))
+            return 0.f;
+
+        float radius_sq = half_width * half_width;
+        float prob = 0.f;
+
+        for (int x = x_first; x <= x_last; ++x)
         {
-            snapshot.velocity = compute_velocity(movement_history_.back(), snapshot);
+            // The strip is convex, so its intersection with the line X = wx is a single
+            // interval: the hull of the start cap, end cap and body intersections
+            float wx = cell_center(origin.x, x);
+            float lo = FLT_MAX;
+            float hi = -FLT_MAX;
+
+            // Round caps
+            float cap_dx = wx - start.x;
+            float chord_sq = radius_sq - cap_dx * cap_dx;
+            if (chord_sq >= 0.f)
+            {
+                float h = std::sqrt(chord_sq);
+                lo = std::min(lo, start.z - h);
+                hi = std::max(hi, start.z + h);
+            }
 
-            // Detect auto-attack for post-AA movement analysis
-            if (snapshot.is_auto_attacking && !movement_history_.back().is_auto_attacking)
+            cap_dx = wx - end_x;
+            chord_sq = radius_sq - cap_dx * cap_dx;
+            if (chord_sq >= 0.f)
             {
-                last_aa_time_ = current_time;
+                float h = std::sqrt(chord_sq);
+                lo = std::min(lo, end_z - h);
+                hi = std::max(hi, end_z + h);
             }
 
-            // Track post-AA movement delay
-            if (last_aa_time_ > 0.f && snapshot.velocity.magnitude() > 10.f &&
-                movement_history_.back().velocity.magnitude() < 10.f)
+            // Body: with w = z - start.z and ax = wx - start.x
+            //   along = ax*dx + w*dz  in [0, length]
+            //   perp  = ax*dz - w*dx  in [-half_width, half_width]
+            float ax = wx - start.x;
+            float w_lo = -FLT_MAX;
+            float w_hi = FLT_MAX;
+            bool body_hit = true;
+
+            auto clip = [&](float a, float b, float range_lo, float range_hi)
             {
-                float delay = current_time - last_aa_time_;
-                if (delay < 1.0f) // Only track reasonable delays
+                // Constrain a*w + b to [range_lo, range_hi]
+                if (std::abs(a) < EPSILON)
                 {
-                    post_aa_movement_delays_.push_back(delay);
-                    if (post_aa_movement_delays_.size() > 20)
-                        post_aa_movement_delays_.erase(post_aa_movement_delays_.begin());
+                    if (b < range_lo || b > range_hi)
+                        body_hit = false;
+                    return;
                 }
+                float w0 = (range_lo - b) / a;
+                float w1 = (range_hi - b) / a;
+                if (w0 > w1)
+                    std::swap(w0, w1);
+                w_lo = std::max(w_lo, w0);
+                w_hi = std::min(w_hi, w1);
+            };
+
+            clip(dz, ax * dx, 0.f, length);
+            clip(-dx, ax * dz, -half_width, half_width);
+
+            if (body_hit && w_lo <= w_hi)
+            {
+                lo = std::min(lo, start.z + w_lo);
+                hi = std::max(hi, start.z + w_hi);
             }
-        }
-
-        // Add to history
-        movement_history_.push_back(snapshot);
-
-        // Limit history size
-        if (movement_history_.size() > MOVEMENT_HISTORY_SIZE)
-            movement_history_.pop_front();
 
-        last_update_time_ = current_time;
+            if (lo > hi)
+                continue;
 
-        // Analyze patterns periodically
-        if (movement_history_.size() >= MIN_SAMPLES_FOR_BEHAVIOR &&
-            static_cast<int>(movement_history_.size()) % 20 == 0)
-        {
-            analyze_patterns();
+            int z_first, z_last;
+            if (cell_range(origin.z, lo, hi, active_z_first, active_z_last, z_first, z_last))
+                prob += row_span_probability(x, z_first, z_last);
         }
-    }
 
-    void TargetBehaviorTracker::analyze_patterns()
-    {
-        update_dodge_pattern();
-        detect_direction_changes();
+        return std::max(prob, 0.f);
     }
 
-    math::vector3 TargetBehaviorTracker::compute_velocity(
-        const MovementSnapshot& prev,
-        const MovementSnapshot& curr) const
+    float BehaviorPDF::cone_probability(
+        const math::vector3& apex,
+        const math::vector3& direction,
+        float half_angle,
+        float range) const
     {
-        float dt = curr.timestamp - prev.timestamp;
-        if (dt < EPSILON)
-            return math::vector3{};
-
-        return (curr.position - prev.position) / dt;
-    }
+        if (range <= 0.f || half_angle <= 0.f)
+            return 0.f;
 
-    void TargetBehaviorTracker::update_dodge_pattern()
-    {
-        if (movement_history_.size() < 3)
-            return;
+        // Work in XZ only (matches SIMD::in_cone)
+        float dir_len = std::sqrt(direction.x * direction.x + direction.z * direction.z);
+        if (half_angle >= PI || dir_len < EPSILON)
+            return circle_probability(apex, range);
+
+        float dx = direction.x / dir_len;
+        float dz = direction.z / dir_len;
+
+        // Edge half-planes n . (p - apex) >= 0, one per bounding ray (axis rotated by
+        // -/+ half_angle). The sector is their intersection for half_angle <= 90 degrees
+        // and their union beyond, each clipped to the range disk.
+        float c = std::cos(half_angle);
+        float s = std::sin(half_angle);
+        float n1_x = dx * s + dz * c;
+        float n1_z = dz * s - dx * c;
+        float n2_x = dx * s - dz * c;
+        float n2_z = dz * s + dx * c;
+        bool convex = half_angle <= PI * 0.5f;
+
+        int x_first, x_last;
+        if (!cell_range(origin.x, apex.x - range, apex.x + range, active_x_first, active_x_last, x_first, x_last))
+            return 0.f;
 
-        int left_count = 0, right_count = 0, forward_count = 0, backward_count = 0;
-        int total_movements = 0;
+        float range_sq = range * range;
+        float prob = 0.f;
 
-        // Analyze movement directions relative to previous direction
-        for (size_t i = 2; i < movement_history_.size(); ++i)
+        for (int x = x_first; x <= x_last; ++x)
         {
-            const auto& prev = movement_history_[i - 1];
-            const auto& curr = movement_history_[i];
-
-            if (prev.velocity.magnitude() < 10.f || curr.velocity.magnitude() < 10.f)
+            float ax = cell_center(origin.x, x) - apex.x;
+            float chord_sq = range_sq - ax * ax;
+            if (chord_sq < 0.f)
                 continue;
 
-            // Compute perpendicular and parallel components
-            math::vector3 prev_dir = prev.velocity.normalized();
-            math::vector3 curr_dir = curr.velocity.normalized();
-
-            // Cross product to determine left/right (y component)
-            float cross_y = prev_dir.x * curr_dir.z - prev_dir.z * curr_dir.x;
-
-            // Dot product to determine forward/backward
-            float dot = prev_dir.dot(curr_dir);
+            // Offsets w = z - apex.z on this row's line inside the disk and each half-plane
+            float h = std::sqrt(chord_sq);
+            auto clip = [&](float n_x, float n_z, float& lo, float& hi)
+            {
+                // n_x * ax + n_z * w >= 0
+                lo = -h;
+                hi = h;
+                float b = n_x * ax;
+                if (std::abs(n_z) < EPSILON)
+                {
+                    if (b < 0.f)
+                        hi = -FLT_MAX;
+                    return;
+                }
+                float w0 = -b / n_z;
+                if (n_z > 0.f)
+                    lo = std::max(lo, w0);
+                else
+                    hi = std::min(hi, w0);
+            };
 
-            if (cross_y > 0.1f) left_count++;
-            else if (cross_y < -0.1f) right_count++;
+            float lo1, hi1, lo2, hi2;
+            clip(n1_x, n1_z, lo1, hi1);
+            clip(n2_x, n2_z, lo2, hi2);
 
-            if (dot > 0.5f) forward_count++;
-            else if (dot < -0.5f) backward_count++;
+            auto add_span = [&](float lo, float hi)
+            {
+                int z_first, z_last;
+                if (lo <= hi && cell_range(origin.z, apex.z + lo, apex.z + hi,
+                    active_z_first, active_z_last, z_first, z_last))
+                    prob += row_span_probability(x, z_first, z_last);
+            };
 
-            total_movements++;
+            if (convex)
+            {
+                add_span(std::max(lo1, lo2), std::min(hi1, hi2));
+            }
+            else if (lo1 > hi1 || lo2 > hi2 || hi1 < lo2 || hi2 < lo1)
+            {
+                // Disjoint (or one empty): two separate spans
+                add_span(lo1, hi1);
+                add_span(lo2, hi2);
+            }
+            else
+            {
+                add_span(std::min(lo1, lo2), std::max(hi1, hi2));
+            }
         }
 
-        if (total_movements > 0)
-        {
-            float inv_total = 1.f / total_movements;
-            dodge_pattern_.left_dodge_frequency = left_count * inv_total;
-            dodge_pattern_.right_dodge_frequency = right_count * inv_total;
-            dodge_pattern_.forward_frequency = forward_count * inv_total;
-            dodge_pattern_.backward_frequency = backward_count * inv_total;
+        return std::max(prob, 0.f);
+    }
 
-            // Linear continuation probability
-            dodge_pattern_.linear_continuation_prob = forward_count * inv_total;
+    void BehaviorPDF::add_weighted_sample(const math::vector3& pos, float weight)
+    {
+        // Convert world position to grid coordinates
+        float dx = pos.x - origin.x;
+        float dz = pos.z - origin.z;
+
+        int grid_x = static_cast<int>((dx / cell_size) + GRID_SIZE / 2);
+        int grid_z = static_cast<int>((dz / cell_size) + GRID_SIZE / 2);
+
+        // Gaussian kernel (spread probability to nearby cells, weights precomputed)
+        const auto& kernel = Tables::PDF_SPLAT_KERNEL;
+        constexpr int kernel_radius = 2;
+
+        static_assert(Tables::GaussianKernel<kernel_radius>::WIDTH == 2 * kernel_radius + 1);
+
+        // Clip kernel columns to the grid once (same span for every row)
+        int j_first = std::max(-kernel_radius, -grid_z);
+        int j_last = std::min(kernel_radius, GRID_SIZE - 1 - grid_z);
+        int i_first = std::max(-kernel_radius, -grid_x);
+        int i_last = std::min(kernel_radius, GRID_SIZE - 1 - grid_x);
+        if (j_first > j_last || i_first > i_last)
+            return;
+
+        for (int i = i_first; i <= i_last; ++i)
+        {
+            const float* kernel_row = &kernel.weights[i + kernel_radius][j_first + kernel_radius];
+            SIMD::add_scaled(&pdf_grid[grid_x + i][grid_z + j_first], kernel_row, j_last - j_first + 1, weight);
+        }
+
+        active_x_first = std::min(active_x_first, grid_x + i_first);
+        active_x_last = std::max(active_x_last, grid_x + i_last);
+        active_z_first = std::min(active_z_first, grid_z + j_first);
+        active_z_last = std::max(active_z_last, grid_z + j_last);
+    }
+
+    void BehaviorPDF::mask_unwalkable()
+    {
+        if (!NavGrid::is_built())
+            return;
+
+        bool wall[GRID_SIZE][GRID_SIZE];
+        bool any_wall = false;
+        float kept_mass = 0.f;
+
+        // Cells outside the active box hold no mass: nothing to mask there
+        for (int x = active_x_first; x <= active_x_last; ++x)
+        {
+            float wx = cell_center(origin.x, x);
+            for (int z = active_z_first; z <= active_z_last; ++z)
+            {
+                wall[x][z] = !NavGrid::is_walkable(wx, cell_center(origin.z, z));
+                if (wall[x][z])
+                    any_wall = true;
+                else
+                    kept_mass += pdf_grid[x][z];
+            }
+        }
+
+        // Target hugging/inside a wall with every sample masked: keep the unmasked PDF
+        if (!any_wall || kept_mass < EPSILON)
+            return;
+
+        for (int x = active_x_first; x <= active_x_last; ++x)
+            for (int z = active_z_first; z <= active_z_last; ++z)
+                if (wall[x][z])
+                    pdf_grid[x][z] = 0.f;
+    }
+
+    void CompactBehaviorPDF::compress(const BehaviorPDF& pdf)
+    {
+        origin = pdf.origin;
+        cell_size = pdf.cell_size;
+        total_probability = pdf.total_probability;
+        x_first = pdf.active_x_first;
+        z_first = pdf.active_z_first;
+        rows = pdf.has_active_cells() ? pdf.active_x_last - pdf.active_x_first + 1 : 0;
+        columns = pdf.has_active_cells() ? pdf.active_z_last - pdf.active_z_first + 1 : 0;
+
+        float peak = 0.f;
+        for (int i = 0; i < rows; ++i)
+            for (int j = 0; j < columns; ++j)
+                peak = std::max(peak, pdf.pdf_grid[x_first + i][z_first + j]);
+
+        quantum = peak / 65535.f;
+        float inv_quantum = peak > 0.f ? 1.f / quantum : 0.f;
+
+        cells.resize(static_cast<size_t>(rows) * columns);
+        for (int i = 0; i < rows; ++i)
+            for (int j = 0; j < columns; ++j)
+                cells[static_cast<size_t>(i) * columns + j] = static_cast<uint16_t>(
+                    std::lround(std::clamp(pdf.pdf_grid[x_first + i][z_first + j] * inv_quantum, 0.f, 65535.f)));
+    }
+
+    void CompactBehaviorPDF::expand(BehaviorPDF& pdf) const
+    {
+        pdf.clear();
+        pdf.origin = origin;
+        pdf.cell_size = cell_size;
+        if (rows == 0 || columns == 0)
+            return;
+
+        for (int i = 0; i < rows; ++i)
+            for (int j = 0; j < columns; ++j)
+                pdf.pdf_grid[x_first + i][z_first + j] = cells[static_cast<size_t>(i) * columns + j] * quantum;
+
+        pdf.active_x_first = x_first;
+        pdf.active_x_last = x_first + rows - 1;
+        pdf.active_z_first = z_first;
+        pdf.active_z_last = z_first + columns - 1;
+
+        // Renormalizes away rounding and rebuilds the SAT; unnormalized
+        // (empty-history) PDFs keep their zero total
+        pdf.normalize();
+        if (total_probability < EPSILON)
+            pdf.total_probability = total_probability;
+    }
+
+    // =========================================================================
+    // TARGET BEHAVIOR TRACKER IMPLEMENTATION
+    // =========================================================================
+
+    TargetBehaviorTracker::TargetBehaviorTracker(game_object* target)
+        : target_(target), last_update_time_(0.f),
+        left_count_(0), right_count_(0), forward_count_(0), backward_count_(0), moving_pair_count_(0),
+        interval_sq_sum_(0.0), lateral_sum_(0.0), last_aa_time_(0.f), pdf_cache_clock_(0),
+        lod_(TrackerLod::full), samples_since_analysis_(0),
+        profile_prior_weight_(0.f), profile_hash_(0)
+    {
+    }
+
+    void TargetBehaviorTracker::update()
+    {
+        if (!target_ || !target_->is_valid())
+            return;
+
+        float current_time = g_sdk->clock_facade->get_game_time();
+
+        // Sample at the relevance tier's rate (MOVEMENT_SAMPLE_RATE at full fidelity)
+        if (current_time - last_update_time_ < TRACKER_LOD_PARAMS[static_cast<int>(lod_)].sample_interval)
+            return;
+
+        HYBRID_PROFILE_SCOPE(tracker_update);
+
+        // Create snapshot
+        MovementSnapshot snapshot;
+        snapshot.position = target_->get_position();
+        snapshot.timestamp = current_time;
+
+        snapshot.is_auto_attacking = is_auto_attacking(target_);
+        snapshot.is_casting = is_casting_spell(target_);
+        snapshot.is_dashing = target_->is_dashing();
+
+        // One buff pass per frame, shared with the edge case snapshot
+        EdgeCases::BuffState buffs = EdgeCases::get_frame_buff_state(target_);
+        snapshot.is_cced = buffs.is_cced();
+
+        // Safety: Prevent division by zero
+        float max_hp = target_->get_max_hp();
+        snapshot.hp_percent = (max_hp > 0.f) ? (target_->get_hp() / max_hp) * 100.f : 100.f;
+
+        // Trace recording (offline replay/benchmark input)
+        if (Trace::Recorder::is_active())
+        {
+            Trace::Recorder::record_snapshot(target_->get_network_id(), snapshot,
+                target_->get_move_speed(), target_->get_bounding_radius());
+        }
+
+        ingest_snapshot(snapshot);
+    }
+
+    void TargetBehaviorTracker::ingest_snapshot(MovementSnapshot snapshot)
+    {
+        float current_time = snapshot.timestamp;
+
+        // Compute velocity if we have previous snapshot
+        if (!movement_history_.empty())
+        {
+            const MovementSnapshot previous = movement_history_.back();
+            snapshot.velocity = compute_velocity(previous, snapshot);
+
+            // Detect auto-attack for post-AA movement analysis
+            if (snapshot.is_auto_attacking && !previous.is_auto_attacking)
+            {
+                last_aa_time_ = current_time;
+            }
+
+            // Track post-AA movement delay
+            if (last_aa_time_ > 0.f && snapshot.velocity.magnitude() > 10.f &&
+                previous.velocity.magnitude() < 10.f)
+            {
+                float delay = current_time - last_aa_time_;
+                if (delay < 1.0f) // Only track reasonable delays
+                {
+                    // Ring keeps the last POST_AA_DELAY_SAMPLES delays
+                    post_aa_movement_delays_.push_back(delay);
+                }
+            }
+        }
+
+        // Add to history (ring overwrites the oldest sample once MOVEMENT_HISTORY_SIZE is reached)
+        bool evicted = movement_history_.size() == MovementHistory::CAPACITY;
+        movement_history_.push_back(snapshot);
+        update_running_statistics(evicted);
+
+        last_update_time_ = current_time;
+
+        // Statistics are maintained incrementally, so publishing them is O(1) per sample
+        // Coarser LOD tiers publish every analysis_stride samples
+        if (movement_history_.size() >= MIN_SAMPLES_FOR_BEHAVIOR &&
+            ++samples_since_analysis_ >= TRACKER_LOD_PARAMS[static_cast<int>(lod_)].analysis_stride)
+        {
+            analyze_patterns();
+            samples_since_analysis_ = 0;
+        }
+    }
+
+    void TargetBehaviorTracker::set_lod(TrackerLod lod)
+    {
+        if (lod < lod_ && samples_since_analysis_ > 0 && movement_history_.size() >= MIN_SAMPLES_FOR_BEHAVIOR)
+        {
+            analyze_patterns();
+            samples_since_analysis_ = 0;
+        }
+        lod_ = lod;
+    }
+
+    void TargetBehaviorTracker::update_running_statistics(bool evicted)
+    {
+        size_t count = movement_history_.size();
+        size_t newest = count - 1;
+
+        // Classify the new sample against its predecessors
+        SampleAnalysis sample;
+        float turn_angle = 0.f;
+
+        if (count >= 2)
+        {
+            math::vector3 curr_velocity = movement_history_.velocity(newest);
+            math::vector3 prev_velocity = movement_history_.velocity(newest - 1);
+
+            if (prev_velocity.magnitude() >= 10.f && curr_velocity.magnitude() >= 10.f)
+            {
+                math::vector3 prev_dir = prev_velocity.normalized();
+                math::vector3 curr_dir = curr_velocity.normalized();
+
+                // Cross product Y component determines left/right, dot forward/backward
+                float cross_y = prev_dir.x * curr_dir.z - prev_dir.z * curr_dir.x;
+                float dot = prev_dir.dot(curr_dir);
+
+                sample.flags |= SampleAnalysis::MOVING_PAIR;
+                if (cross_y > 0.1f) sample.flags |= SampleAnalysis::LEFT;
+                else if (cross_y < -0.1f) sample.flags |= SampleAnalysis::RIGHT;
+
+                if (dot > 0.5f) sample.flags |= SampleAnalysis::FORWARD;
+                else if (dot < -0.5f) sample.flags |= SampleAnalysis::BACKWARD;
+
+                sample.juke = cross_y > 0.15f ? -1 : (cross_y < -0.15f ? 1 : 0);
+            }
+
+            if (count >= 3)
+            {
+                math::vector3 older_velocity = movement_history_.velocity(newest - 2);
+                if (older_velocity.magnitude() >= 10.f && curr_velocity.magnitude() >= 10.f)
+                {
+                    math::vector3 older_dir = older_velocity.normalized();
+                    math::vector3 curr_dir = curr_velocity.normalized();
+                    turn_angle = std::acos(std::clamp(older_dir.dot(curr_dir), -1.f, 1.f));
+
+                    if (turn_angle > 0.5f) // ~30 degrees
+                        sample.flags |= SampleAnalysis::TURN;
+                }
+            }
+        }
+
+        // Window covers history indices [2, count): on eviction the sample that was
+        // at index 2 slides to index 1 and leaves it
+        if (evicted)
+            retire_sample_statistics(sample_analysis_[2]);
+
+        sample_analysis_.push_back(sample);
+
+        if (newest >= 2)
+            add_sample_statistics(sample, movement_history_.timestamp(newest), turn_angle);
+    }
+
+    void TargetBehaviorTracker::add_sample_statistics(const SampleAnalysis& sample, float timestamp, float turn_angle)
+    {
+        if (sample.flags & SampleAnalysis::MOVING_PAIR)
+        {
+            ++moving_pair_count_;
+            if (sample.flags & SampleAnalysis::LEFT) ++left_count_;
+            if (sample.flags & SampleAnalysis::RIGHT) ++right_count_;
+            if (sample.flags & SampleAnalysis::FORWARD) ++forward_count_;
+            if (sample.flags & SampleAnalysis::BACKWARD) ++backward_count_;
+        }
+
+        if (sample.flags & SampleAnalysis::TURN)
+        {
+            if (!direction_change_times_.empty())
+            {
+                double interval = timestamp - direction_change_times_.back();
+                interval_sq_sum_ += interval * interval;
+            }
+
+            direction_change_times_.push_back(timestamp);
+            direction_change_angles_.push_back(turn_angle);
+            lateral_sum_ += std::abs(std::sin(turn_angle));
+        }
+    }
+
+    void TargetBehaviorTracker::retire_sample_statistics(const SampleAnalysis& sample)
+    {
+        if (sample.flags & SampleAnalysis::MOVING_PAIR)
+        {
+            --moving_pair_count_;
+            if (sample.flags & SampleAnalysis::LEFT) --left_count_;
+            if (sample.flags & SampleAnalysis::RIGHT) --right_count_;
+            if (sample.flags & SampleAnalysis::FORWARD) --forward_count_;
+            if (sample.flags & SampleAnalysis::BACKWARD) --backward_count_;
+        }
+
+        // Retiring sample is the oldest in the window, so its turn is the oldest change
+        if (sample.flags & SampleAnalysis::TURN)
+        {
+            if (direction_change_times_.size() >= 2)
+            {
+                double interval = direction_change_times_[1] - direction_change_times_[0];
+                interval_sq_sum_ -= interval * interval;
+            }
+
+            lateral_sum_ -= std::abs(std::sin(direction_change_angles_.front()));
+            direction_change_times_.pop_front();
+            direction_change_angles_.pop_front();
+
+            // Reset accumulated rounding once the window empties
+            if (direction_change_times_.size() < 2)
+                interval_sq_sum_ = 0.0;
+            if (direction_change_angles_.empty())
+                lateral_sum_ = 0.0;
+        }
+    }
+
+    void TargetBehaviorTracker::analyze_patterns()
+    {
+        update_dodge_pattern();
+        detect_direction_changes();
+    }
+
+    math::vector3 TargetBehaviorTracker::compute_velocity(
+        const MovementSnapshot& prev,
+        const MovementSnapshot& curr) const
+    {
+        float dt = curr.timestamp - prev.timestamp;
+        if (dt < EPSILON)
+            return math::vector3{};
+
+        return (curr.position - prev.position) / dt;
+    }
+
+    void TargetBehaviorTracker::update_dodge_pattern()
+    {
+        if (movement_history_.size() < 3)
+            return;
+
+        // Movement directions relative to previous direction (running window counts)
+        // A champion profile prior contributes profile_prior_weight_ pseudo-pairs
+        const float prior_weight = profile_prior_weight_;
+        if (moving_pair_count_ > 0)
+        {
+            float inv_total = 1.f / (moving_pair_count_ + prior_weight);
+            dodge_pattern_.left_dodge_frequency = (left_count_ + prior_weight * profile_prior_.left_dodge_frequency) * inv_total;
+            dodge_pattern_.right_dodge_frequency = (right_count_ + prior_weight * profile_prior_.right_dodge_frequency) * inv_total;
+            dodge_pattern_.forward_frequency = (forward_count_ + prior_weight * profile_prior_.forward_frequency) * inv_total;
+            dodge_pattern_.backward_frequency = (backward_count_ + prior_weight * profile_prior_.backward_frequency) * inv_total;
+
+            // Linear continuation probability
+            dodge_pattern_.linear_continuation_prob = dodge_pattern_.forward_frequency;
         }
 
-        // Update reaction delay from post-AA movement data
-        dodge_pattern_.reaction_delay = 200.f; // Default 200ms
+        // Update reaction delay from post-AA movement data (prior: profile, else 200ms)
+        dodge_pattern_.reaction_delay = profile_prior_.reaction_delay;
 
         if (!post_aa_movement_delays_.empty())
         {
             float sum = 0.f;
-            for (float delay : post_aa_movement_delays_)
-                sum += delay;
-            dodge_pattern_.reaction_delay = (sum / post_aa_movement_delays_.size()) * 1000.f;
+            for (size_t i = 0; i < post_aa_movement_delays_.size(); ++i)
+                sum += post_aa_movement_delays_[i];
+            dodge_pattern_.reaction_delay = (sum * 1000.f + prior_weight * profile_prior_.reaction_delay) /
+                (post_aa_movement_delays_.size() + prior_weight);
         }
 
         // PATTERN REPETITION DETECTION
@@ -268,7 +1158,7 @@ namespace HybridPred
         if (!movement_history_.empty())
         {
             float current_time = g_sdk->clock_facade->get_game_time();
-            float last_movement_time = movement_history_.back().timestamp;
+            float last_movement_time = movement_history_.timestamp(movement_history_.size() - 1);
             constexpr float PATTERN_EXPIRY_DURATION = 3.0f;  // 3 seconds of inactivity
 
             if (dodge_pattern_.has_pattern &&
@@ -282,32 +1172,17 @@ namespace HybridPred
             }
         }
 
-        // Build juke sequence from recent direction changes
+        // Build juke sequence from recent direction changes (codes precomputed per sample)
         dodge_pattern_.juke_sequence.clear();
-        constexpr size_t MAX_SEQUENCE_LENGTH = 8;
+        constexpr size_t MAX_SEQUENCE_LENGTH = DodgePattern::JUKE_SEQUENCE_LENGTH;
 
         for (size_t i = movement_history_.size() > MAX_SEQUENCE_LENGTH + 1 ?
             movement_history_.size() - MAX_SEQUENCE_LENGTH : 1;
             i < movement_history_.size(); ++i)
         {
-            const auto& prev = movement_history_[i - 1];
-            const auto& curr = movement_history_[i];
-
-            if (prev.velocity.magnitude() < 10.f || curr.velocity.magnitude() < 10.f)
-                continue;
-
-            math::vector3 prev_dir = prev.velocity.normalized();
-            math::vector3 curr_dir = curr.velocity.normalized();
-
-            // Cross product Y component determines left (-1) or right (1)
-            float cross_y = prev_dir.x * curr_dir.z - prev_dir.z * curr_dir.x;
-
-            if (cross_y > 0.15f)
-                dodge_pattern_.juke_sequence.push_back(-1);  // Left
-            else if (cross_y < -0.15f)
-                dodge_pattern_.juke_sequence.push_back(1);   // Right
-            else
-                dodge_pattern_.juke_sequence.push_back(0);   // Straight
+            const SampleAnalysis& sample = sample_analysis_[i];
+            if (sample.flags & SampleAnalysis::MOVING_PAIR)
+                dodge_pattern_.juke_sequence.push_back(sample.juke);  // -1 left, 1 right, 0 straight
         }
 
         // Detect alternating pattern (L-R-L-R or R-L-R-L)
@@ -343,8 +1218,7 @@ namespace HybridPred
                 int last_juke = dodge_pattern_.juke_sequence.back();
                 if (last_juke != 0 && !movement_history_.empty())
                 {
-                    const auto& latest = movement_history_.back();
-                    math::vector3 vel_dir = latest.velocity.normalized();
+                    math::vector3 vel_dir = movement_history_.velocity(movement_history_.size() - 1).normalized();
                     // Perpendicular: 90° rotation in XZ plane
                     math::vector3 perpendicular(-vel_dir.z, 0.f, vel_dir.x);
                     dodge_pattern_.predicted_next_direction = perpendicular * static_cast<float>(-last_juke);
@@ -378,8 +1252,7 @@ namespace HybridPred
                     int next_in_sequence = dodge_pattern_.juke_sequence[dodge_pattern_.juke_sequence.size() % half];
                     if (next_in_sequence != 0 && !movement_history_.empty())
                     {
-                        const auto& latest = movement_history_.back();
-                        math::vector3 vel_dir = latest.velocity.normalized();
+                        math::vector3 vel_dir = movement_history_.velocity(movement_history_.size() - 1).normalized();
                         math::vector3 perpendicular(-vel_dir.z, 0.f, vel_dir.x);
                         dodge_pattern_.predicted_next_direction = perpendicular * static_cast<float>(next_in_sequence);
                     }
@@ -397,67 +1270,112 @@ namespace HybridPred
 
     void TargetBehaviorTracker::detect_direction_changes()
     {
-        direction_change_times_.clear();
-        direction_change_angles_.clear();
+        // Direction changes are tracked as a sliding window in update_running_statistics()
+        // Compute juke interval statistics from the running sums
+        // (champion profile prior: profile_prior_weight_ pseudo-intervals)
+        size_t change_count = direction_change_times_.size();
+        if (change_count >= 2)
+        {
+            double prior_weight = profile_prior_weight_;
+            double prior_mean = profile_prior_.juke_interval_mean;
+            double prior_sq = profile_prior_.juke_interval_variance + prior_mean * prior_mean;
+            double interval_count = static_cast<double>(change_count - 1) + prior_weight;
+
+            // Mean: intervals telescope to (last - first)
+            double mean = (direction_change_times_.back() - direction_change_times_.front() +
+                prior_weight * prior_mean) / interval_count;
+            dodge_pattern_.juke_interval_mean = static_cast<float>(mean);
+
+            // Variance: E[Δt²] - mean² (clamped against rounding)
+            double variance = (interval_sq_sum_ + prior_weight * prior_sq) / interval_count - mean * mean;
+            dodge_pattern_.juke_interval_variance = static_cast<float>(std::max(variance, 0.0));
+        }
+    }
 
-        if (movement_history_.size() < 3)
+    bool TargetBehaviorTracker::is_animation_locked() const
+    {
+        if (movement_history_.empty())
+            return false;
+
+        constexpr uint8_t LOCK_FLAGS = MovementHistory::FLAG_AUTO_ATTACKING |
+            MovementHistory::FLAG_CASTING | MovementHistory::FLAG_CCED;
+        return (movement_history_.flags(movement_history_.size() - 1) & LOCK_FLAGS) != 0;
+    }
+
+    void TargetBehaviorTracker::apply_profile(uint32_t champion_hash, const ProfileRecord* record)
+    {
+        profile_hash_ = champion_hash;
+        if (!record || record->dodge_observations == 0)
             return;
 
-        for (size_t i = 2; i < movement_history_.size(); ++i)
-        {
-            const auto& prev = movement_history_[i - 2];
-            const auto& mid = movement_history_[i - 1];
-            const auto& curr = movement_history_[i];
+        // Partially learned profiles count for proportionally fewer pseudo-samples
+        float maturity = std::min(1.f, static_cast<float>(record->dodge_observations) / PROFILE_FULL_OBSERVATIONS);
+        profile_prior_weight_ = PROFILE_PRIOR_SAMPLES * maturity;
 
-            if (prev.velocity.magnitude() < 10.f || curr.velocity.magnitude() < 10.f)
-                continue;
+        profile_prior_.left_dodge_frequency = record->left_dodge_frequency;
+        profile_prior_.right_dodge_frequency = record->right_dodge_frequency;
+        profile_prior_.forward_frequency = record->forward_frequency;
+        profile_prior_.backward_frequency = record->backward_frequency;
+        profile_prior_.linear_continuation_prob = record->forward_frequency;
+        if (record->juke_observations > 0)
+        {
+            profile_prior_.juke_interval_mean = record->juke_interval_mean;
+            profile_prior_.juke_interval_variance = record->juke_interval_variance;
+        }
+        if (record->reaction_observations > 0)
+            profile_prior_.reaction_delay = record->reaction_delay;
+
+        // No live data yet: the prior is the whole estimate
+        dodge_pattern_.left_dodge_frequency = profile_prior_.left_dodge_frequency;
+        dodge_pattern_.right_dodge_frequency = profile_prior_.right_dodge_frequency;
+        dodge_pattern_.forward_frequency = profile_prior_.forward_frequency;
+        dodge_pattern_.backward_frequency = profile_prior_.backward_frequency;
+        dodge_pattern_.linear_continuation_prob = profile_prior_.linear_continuation_prob;
+        dodge_pattern_.juke_interval_mean = profile_prior_.juke_interval_mean;
+        dodge_pattern_.juke_interval_variance = profile_prior_.juke_interval_variance;
+        dodge_pattern_.reaction_delay = profile_prior_.reaction_delay;
+    }
 
-            // Detect significant direction change
-            math::vector3 prev_dir = prev.velocity.normalized();
-            math::vector3 curr_dir = curr.velocity.normalized();
+    bool TargetBehaviorTracker::observe_profile(ProfileObservation& out) const
+    {
+        if (moving_pair_count_ < MIN_SAMPLES_FOR_BEHAVIOR)
+            return false;
 
-            float angle = std::acos(std::clamp(prev_dir.dot(curr_dir), -1.f, 1.f));
+        float inv_total = 1.f / moving_pair_count_;
+        out.left_dodge_frequency = left_count_ * inv_total;
+        out.right_dodge_frequency = right_count_ * inv_total;
+        out.forward_frequency = forward_count_ * inv_total;
+        out.backward_frequency = backward_count_ * inv_total;
 
-            if (angle > 0.5f) // ~30 degrees
-            {
-                direction_change_times_.push_back(curr.timestamp);
-                direction_change_angles_.push_back(angle);
-            }
+        size_t change_count = direction_change_times_.size();
+        out.has_juke = change_count >= 2;
+        if (out.has_juke)
+        {
+            double interval_count = static_cast<double>(change_count - 1);
+            double mean = (direction_change_times_.back() - direction_change_times_.front()) / interval_count;
+            out.juke_interval_mean = static_cast<float>(mean);
+            out.juke_interval_variance = static_cast<float>(std::max(interval_sq_sum_ / interval_count - mean * mean, 0.0));
         }
 
-        // Compute juke interval statistics
-        if (direction_change_times_.size() >= 2)
+        out.has_reaction = !post_aa_movement_delays_.empty();
+        if (out.has_reaction)
         {
-            std::vector<float> intervals;
-            for (size_t i = 1; i < direction_change_times_.size(); ++i)
-            {
-                intervals.push_back(direction_change_times_[i] - direction_change_times_[i - 1]);
-            }
-
-            // Mean
             float sum = 0.f;
-            for (float interval : intervals)
-                sum += interval;
-            dodge_pattern_.juke_interval_mean = sum / intervals.size();
-
-            // Variance
-            float variance_sum = 0.f;
-            for (float interval : intervals)
-            {
-                float diff = interval - dodge_pattern_.juke_interval_mean;
-                variance_sum += diff * diff;
-            }
-            dodge_pattern_.juke_interval_variance = variance_sum / intervals.size();
+            for (size_t i = 0; i < post_aa_movement_delays_.size(); ++i)
+                sum += post_aa_movement_delays_[i];
+            out.reaction_delay = sum / post_aa_movement_delays_.size() * 1000.f;
         }
+
+        return true;
     }
 
-    bool TargetBehaviorTracker::is_animation_locked() const
+    void TargetBehaviorTracker::copy_pdf_inputs(TargetBehaviorTracker& snapshot) const
     {
-        if (movement_history_.empty())
-            return false;
-
-        const auto& latest = movement_history_.back();
-        return latest.is_auto_attacking || latest.is_casting || latest.is_cced;
+        snapshot.movement_history_ = movement_history_;
+        snapshot.dodge_pattern_ = dodge_pattern_;
+        snapshot.direction_change_angles_ = direction_change_angles_;
+        snapshot.lateral_sum_ = lateral_sum_;
+        snapshot.last_update_time_ = last_update_time_;
     }
 
     math::vector3 TargetBehaviorTracker::get_current_velocity() const
@@ -465,10 +1383,10 @@ namespace HybridPred
         if (movement_history_.empty())
             return math::vector3{};
 
-        return movement_history_.back().velocity;
+        return movement_history_.velocity(movement_history_.size() - 1);
     }
 
-    BehaviorPDF TargetBehaviorTracker::build_behavior_pdf(float prediction_time, float move_speed) const
+    const BehaviorPDF& TargetBehaviorTracker::get_behavior_pdf(float prediction_time, float move_speed) const
     {
         // PDF caching: Reuse cached PDF if same frame and similar parameters
         // This avoids rebuilding for Q/W/E/R predictions on the same target in one frame
@@ -476,22 +1394,70 @@ namespace HybridPred
         constexpr float TIME_TOLERANCE = 0.05f;  // 50ms tolerance for prediction_time similarity
         constexpr float SPEED_TOLERANCE = 20.f;  // 20 units/s tolerance for move_speed
 
-        bool same_frame = std::abs(current_time - cached_timestamp_) < EPSILON;
-        bool similar_pred_time = std::abs(prediction_time - cached_prediction_time_) < TIME_TOLERANCE;
-        bool similar_move_speed = std::abs(move_speed - cached_move_speed_) < SPEED_TOLERANCE;
+        PDFCacheEntry* victim = &pdf_cache_[0];
+        for (auto& entry : pdf_cache_)
+        {
+            bool same_frame = std::abs(current_time - entry.timestamp) < EPSILON;
+            if (!same_frame)
+            {
+                // Stale slot: preferred replacement target
+                if (std::abs(current_time - victim->timestamp) < EPSILON || entry.last_used < victim->last_used)
+                    victim = &entry;
+                continue;
+            }
+
+            bool similar_pred_time = std::abs(prediction_time - entry.prediction_time) < TIME_TOLERANCE;
+            bool similar_move_speed = std::abs(move_speed - entry.move_speed) < SPEED_TOLERANCE;
+            if (similar_pred_time && similar_move_speed)
+            {
+                // Cache hit - return cached PDF
+                entry.last_used = ++pdf_cache_clock_;
+                ++pdf_cache_stats_.hits;
+                return entry.pdf;
+            }
+
+            // Live slot: only replaced when no stale slot exists (least recently used)
+            bool victim_live = std::abs(current_time - victim->timestamp) < EPSILON;
+            if (victim_live && entry.last_used < victim->last_used)
+                victim = &entry;
+        }
+
+        ++pdf_cache_stats_.misses;
+        if (victim->timestamp >= 0.f)
+            ++pdf_cache_stats_.evictions;
 
-        if (same_frame && similar_pred_time && similar_move_speed && cached_pdf_.total_probability > EPSILON)
+        // Rebuild into the victim slot (background worker result if it saw the latest sample)
+        HYBRID_PROFILE_SCOPE(behavior_pdf);
+        const CompactBehaviorPDF* precomputed = (target_ && !movement_history_.empty())
+            ? PdfWorker::find(target_->get_network_id(), movement_history_.timestamp(movement_history_.size() - 1),
+                prediction_time, move_speed)
+            : nullptr;
+
+        if (precomputed)
+        {
+            precomputed->expand(victim->pdf);
+        }
+        else
         {
-            // Cache hit - return cached PDF
-            return cached_pdf_;
+            victim->pdf = build_behavior_pdf(prediction_time, move_speed);
+            BehaviorPredictor::apply_contextual_factors(victim->pdf, *this, target_);
         }
 
+        victim->prediction_time = prediction_time;
+        victim->move_speed = move_speed;
+        victim->timestamp = current_time;
+        victim->last_used = ++pdf_cache_clock_;
+        return victim->pdf;
+    }
+
+    BehaviorPDF TargetBehaviorTracker::build_behavior_pdf(float prediction_time, float move_speed) const
+    {
         BehaviorPDF pdf;
 
         if (movement_history_.empty())
             return pdf;
 
-        const auto& latest = movement_history_.back();
+        const MovementSnapshot latest = movement_history_.back();
 
         // DYNAMIC CELL SIZE: Ensure grid covers maximum distance target can move
         // Grid radius = (GRID_SIZE / 2) * cell_size
@@ -523,14 +1489,13 @@ namespace HybridPred
         for (size_t i = 0; i < movement_history_.size() && sample_count < 30; ++i)
         {
             size_t idx = movement_history_.size() - 1 - i;
-            const auto& snapshot = movement_history_[idx];
 
             // Exponential decay weighting (recent data more important)
             // Use adaptive decay rate based on target mobility
             float weight = std::pow(decay_rate, static_cast<float>(i));
 
             // Predict position from this snapshot
-            math::vector3 predicted_pos = snapshot.position + snapshot.velocity * prediction_time;
+            math::vector3 predicted_pos = movement_history_.position(idx) + movement_history_.velocity(idx) * prediction_time;
 
             // Accumulate for weighted average
             predicted_center = predicted_center + predicted_pos * weight;
@@ -558,14 +1523,13 @@ namespace HybridPred
         for (size_t i = 0; i < movement_history_.size() && sample_count < 30; ++i)
         {
             size_t idx = movement_history_.size() - 1 - i;
-            const auto& snapshot = movement_history_[idx];
 
             // Exponential decay weighting (recent data more important)
             // Use adaptive decay rate based on target mobility
             float weight = std::pow(decay_rate, static_cast<float>(i));
 
             // Predict position from this snapshot
-            math::vector3 predicted_pos = snapshot.position + snapshot.velocity * prediction_time;
+            math::vector3 predicted_pos = movement_history_.position(idx) + movement_history_.velocity(idx) * prediction_time;
 
             // Add to PDF with weight
             pdf.add_weighted_sample(predicted_pos, weight);
@@ -593,13 +1557,8 @@ namespace HybridPred
             float lateral_factor = 0.5f;  // Default fallback
             if (direction_change_angles_.size() >= 3)
             {
-                // Average absolute lateral component (sin of angle)
-                float total_lateral = 0.f;
-                for (float angle : direction_change_angles_)
-                {
-                    total_lateral += std::abs(std::sin(angle));
-                }
-                lateral_factor = total_lateral / direction_change_angles_.size();
+                // Average absolute lateral component (sin of angle, running sum)
+                lateral_factor = static_cast<float>(lateral_sum_ / direction_change_angles_.size());
                 lateral_factor = std::clamp(lateral_factor, 0.2f, 0.9f);  // Reasonable bounds
             }
             float dodge_distance = latest.velocity.magnitude() * prediction_time * lateral_factor;
@@ -648,54 +1607,91 @@ namespace HybridPred
             }
         }
 
-        pdf.normalize();
+        // Predicted positions past walls are unreachable: drop that mass before normalizing
+        if (PredictionConfig::get().enable_terrain_awareness)
+            pdf.mask_unwalkable();
 
-        // Update cache for next call
-        cached_pdf_ = pdf;
-        cached_prediction_time_ = prediction_time;
-        cached_move_speed_ = move_speed;
-        cached_timestamp_ = current_time;
+        pdf.normalize();
 
         return pdf;
     }
 
+    const PathCache& TargetBehaviorTracker::get_path_cache() const
+    {
+        if (target_ && target_->is_valid())
+            path_cache_.update(target_->get_path());
+        return path_cache_;
+    }
+
     OpportunityWindow& TargetBehaviorTracker::get_opportunity_window(int spell_slot) const
     {
-        // Create if doesn't exist (mutable map allows modification in const method)
-        if (opportunity_windows_.find(spell_slot) == opportunity_windows_.end())
+        // Start tracking on first use (mutable array allows modification in const method)
+        OpportunityWindow& window = opportunity_windows_[std::clamp(spell_slot + 1, 0, OPPORTUNITY_SLOT_COUNT - 1)];
+        if (!window.in_use)
         {
-            opportunity_windows_[spell_slot] = OpportunityWindow();
             // Safety: Only set window start time if SDK is valid
-            if (g_sdk && g_sdk->clock_facade)
-            {
-                opportunity_windows_[spell_slot].window_start_time = g_sdk->clock_facade->get_game_time();
-            }
+            window.reset((g_sdk && g_sdk->clock_facade) ? g_sdk->clock_facade->get_game_time() : 0.f);
         }
-        return opportunity_windows_[spell_slot];
+        return window;
     }
 
     // =========================================================================
     // OPPORTUNITY WINDOW IMPLEMENTATION
     // =========================================================================
 
+    void OpportunityWindow::reset(float start_time)
+    {
+        history.clear();
+        max_queue.clear();
+        next_sequence = 0;
+        recent_start = 0;
+        recent_sum = 0.0;
+        peak_hit_chance = 0.f;
+        peak_timestamp = 0.f;
+        window_start_time = start_time;
+        last_hit_chance = 0.f;
+        in_use = true;
+    }
+
+    void OpportunityWindow::pop_oldest()
+    {
+        uint32_t sequence = first_sequence();
+        if (!max_queue.empty() && max_queue.front() == sequence)
+            max_queue.pop_front();
+        if (recent_start == sequence)
+        {
+            recent_sum -= history.front().hit_chance;
+            ++recent_start;
+        }
+        history.pop_front();
+    }
+
     void OpportunityWindow::update(float current_time, float hit_chance)
     {
+        // MEMORY SAFETY: Fixed ring, the oldest sample makes room during lag spikes
+        if (history.full())
+            pop_oldest();
+
         // Add current sample to history
         history.push_back({ current_time, hit_chance });
+        uint32_t sequence = next_sequence++;
+        recent_sum += hit_chance;
 
-        // MEMORY SAFETY: Cap deque size to prevent unbounded growth during lag spikes
-        // 240Hz × 10s lag = 2400 entries without cap - limit to 200
-        constexpr size_t MAX_HISTORY_SIZE = 200;
-        while (history.size() > MAX_HISTORY_SIZE)
-        {
-            history.pop_front();
-        }
+        // Monotonic max queue: smaller samples can never be the window maximum again
+        // (equal ones stay, so the front is the earliest maximum)
+        while (!max_queue.empty() && sample(max_queue.back()).hit_chance < hit_chance)
+            max_queue.pop_back();
+        max_queue.push_back(sequence);
 
         // Remove samples older than 3 seconds
-        constexpr float WINDOW_DURATION = 3.0f;
-        while (!history.empty() && current_time - history.front().first > WINDOW_DURATION)
+        while (!history.empty() && current_time - history.front().timestamp > WINDOW_DURATION)
+            pop_oldest();
+
+        // Slide the recent-average start up to the last second
+        while (recent_start != next_sequence && current_time - sample(recent_start).timestamp >= RECENT_DURATION)
         {
-            history.pop_front();
+            recent_sum -= sample(recent_start).hit_chance;
+            ++recent_start;
         }
 
         // Update peak if this is better
@@ -705,23 +1701,16 @@ namespace HybridPred
             peak_timestamp = current_time;
         }
 
-        // Reset peak if too old (more than 2 seconds ago)
-        if (current_time - peak_timestamp > 2.0f)
+        // Reset peak if too old (more than 2 seconds ago): fall back to the window maximum
+        if (current_time - peak_timestamp > PEAK_LIFETIME)
         {
-            // Recalculate peak from current window
-            peak_hit_chance = 0.f;
-            for (const auto& sample : history)
-            {
-                if (sample.second > peak_hit_chance)
-                {
-                    peak_hit_chance = sample.second;
-                    peak_timestamp = sample.first;
-                }
-            }
+            const Sample& best = sample(max_queue.front());
+            peak_hit_chance = best.hit_chance;
+            peak_timestamp = best.timestamp;
         }
     }
 
-    bool OpportunityWindow::is_peak_opportunity(float current_time, float hit_chance, float adaptive_threshold, float elapsed_time, float patience_window) const
+    bool OpportunityWindow::is_peak_opportunity(float hit_chance, float adaptive_threshold, float elapsed_time, float patience_window) const
     {
         // SAFEGUARD 1: Adaptive Patience Window
         // Don't flag peaks too early - wait patience_window seconds
@@ -740,19 +1729,12 @@ namespace HybridPred
             return false;
 
         // Check if this is a local maximum
-        // Compare current hit_chance to recent average (last 1 second)
-        float recent_sum = 0.f;
-        int recent_count = 0;
-        for (auto it = history.rbegin(); it != history.rend() && current_time - it->first < 1.0f; ++it)
-        {
-            recent_sum += it->second;
-            recent_count++;
-        }
-
+        // Compare current hit_chance to recent average (last 1 second, maintained by update)
+        uint32_t recent_count = next_sequence - recent_start;
         if (recent_count < 3)
             return false;
 
-        float recent_avg = recent_sum / recent_count;
+        float recent_avg = static_cast<float>(recent_sum / recent_count);
 
         // Current hit_chance must be above recent average (we're at a peak)
         if (hit_chance < recent_avg * 1.05f)  // 5% margin
@@ -763,10 +1745,10 @@ namespace HybridPred
         // This prevents casting on random noise/blips
         if (history.size() >= 4)
         {
-            float sample_4_ago = history[history.size() - 4].second;
-            float sample_3_ago = history[history.size() - 3].second;
-            float sample_2_ago = history[history.size() - 2].second;
-            float sample_1_ago = history[history.size() - 1].second;
+            float sample_4_ago = history[history.size() - 4].hit_chance;
+            float sample_3_ago = history[history.size() - 3].hit_chance;
+            float sample_2_ago = history[history.size() - 2].hit_chance;
+            float sample_1_ago = history[history.size() - 1].hit_chance;
 
             // SUSTAINED declining trend: 3+ consecutive drops
             bool is_sustained_decline = (sample_1_ago < sample_2_ago) &&
@@ -873,7 +1855,7 @@ namespace HybridPred
         result.adaptive_threshold = window.get_adaptive_threshold(base_threshold, elapsed_time);
 
         // Detect if this is a peak opportunity (uses adaptive_threshold, elapsed_time, and patience_window)
-        result.is_peak_opportunity = window.is_peak_opportunity(current_time, result.hit_chance,
+        result.is_peak_opportunity = window.is_peak_opportunity(result.hit_chance,
             result.adaptive_threshold, elapsed_time,
             patience_window);
 
@@ -882,8 +1864,7 @@ namespace HybridPred
         if (result.hit_chance < window.last_hit_chance * 0.5f && elapsed_time > 1.0f)
         {
             // Significant drop - likely cast occurred, reset window
-            window = OpportunityWindow();
-            window.window_start_time = current_time;
+            window.reset(current_time);
         }
         window.last_hit_chance = result.hit_chance;
     }
@@ -892,6 +1873,7 @@ namespace HybridPred
     // PHYSICS PREDICTOR IMPLEMENTATION
     // =========================================================================
 
+    template<QualityTier TIER>
     ReachableRegion PhysicsPredictor::compute_reachable_region(
         const math::vector3& current_pos,
         const math::vector3& current_velocity,
@@ -900,6 +1882,8 @@ namespace HybridPred
         float turn_rate,
         float acceleration)
     {
+        HYBRID_PROFILE_SCOPE(reachable_region);
+
         ReachableRegion region;
         region.center = current_pos;
 
@@ -945,22 +1929,69 @@ namespace HybridPred
         (void)turn_rate; // Suppress unused parameter warning
 
         // Discretize boundary (circle approximation - full 360° reachability)
-        constexpr int BOUNDARY_POINTS = 32;
-        for (int i = 0; i < BOUNDARY_POINTS; ++i)
+        // With terrain awareness each ray stops at the first wall cell; paths
+        // around a wall corner are not explored (straight-line reach only)
+        const auto& circle = TierParams<TIER>::BOUNDARY;
+        bool clip_terrain = PredictionConfig::get().enable_terrain_awareness && NavGrid::is_built();
+
+        float ray_length[TierParams<TIER>::BOUNDARY.SAMPLES];
+        region.boundary_points = FrameVector<math::vector3>(FrameAllocator<math::vector3>::frame());
+        region.boundary_points.reserve(circle.SAMPLES);
+        for (int i = 0; i < circle.SAMPLES; ++i)
         {
-            float angle = (2.f * PI * i) / BOUNDARY_POINTS;
+            ray_length[i] = clip_terrain
+                ? NavGrid::clip_ray(current_pos, circle.cos_theta[i], circle.sin_theta[i], max_distance)
+                : max_distance;
+            if (ray_length[i] < max_distance)
+                region.terrain_clipped = true;
+
             math::vector3 boundary_point = current_pos;
-            boundary_point.x += max_distance * std::cos(angle);
-            boundary_point.z += max_distance * std::sin(angle);
+            boundary_point.x += ray_length[i] * circle.cos_theta[i];
+            boundary_point.z += ray_length[i] * circle.sin_theta[i];
             region.boundary_points.push_back(boundary_point);
         }
 
-        // Area = πr²
-        region.area = PI * max_distance * max_distance;
+        if (!region.terrain_clipped)
+        {
+            // Area = πr²
+            region.area = PI * max_distance * max_distance;
+            return region;
+        }
+
+        // Star polygon area: Σ ½ r_i r_(i+1) sin(Δθ)
+        float sin_step = std::sin(2.f * PI / circle.SAMPLES);
+        float area = 0.f;
+        for (int i = 0; i < circle.SAMPLES; ++i)
+            area += ray_length[i] * ray_length[(i + 1) % circle.SAMPLES];
+        region.area = 0.5f * sin_step * area;
 
         return region;
     }
 
+    bool ReachableRegion::contains(const math::vector3& point) const
+    {
+        float dx = point.x - center.x;
+        float dz = point.z - center.z;
+        float distance_sq = dx * dx + dz * dz;
+
+        if (distance_sq > max_radius * max_radius)
+            return false;
+        if (!terrain_clipped || boundary_points.empty())
+            return true;
+
+        // Nearest boundary ray (boundary_points[i] lies at angle 2*PI*i/N)
+        int samples = static_cast<int>(boundary_points.size());
+        float angle = std::atan2(dz, dx);
+        if (angle < 0.f)
+            angle += 2.f * PI;
+        int ray = static_cast<int>(angle * samples / (2.f * PI) + 0.5f) % samples;
+
+        const math::vector3& boundary = boundary_points[ray];
+        float bx = boundary.x - center.x;
+        float bz = boundary.z - center.z;
+        return distance_sq <= bx * bx + bz * bz;
+    }
+
     math::vector3 PhysicsPredictor::predict_linear_position(
         const math::vector3& current_pos,
         const math::vector3& current_velocity,
@@ -969,6 +2000,7 @@ namespace HybridPred
         return current_pos + current_velocity * prediction_time;
     }
 
+    template<QualityTier TIER>
     float PhysicsPredictor::compute_physics_hit_probability(
         const math::vector3& cast_position,
         float projectile_radius,
@@ -977,6 +2009,27 @@ namespace HybridPred
         if (reachable_region.area < EPSILON)
             return 0.f;
 
+        if (reachable_region.terrain_clipped)
+        {
+            // Wall-clipped region: estimate |projectile ∩ region| from spiral samples
+            // inside the projectile disc (uniform area), then divide by the polygon area
+            const auto& spiral = TierParams<TIER>::SPIRAL;
+            int inside = 0;
+            for (int i = 0; i < spiral.SAMPLES; ++i)
+            {
+                math::vector3 point = cast_position;
+                float r = projectile_radius * spiral.radius_scale[i];
+                point.x += r * spiral.cos_theta[i];
+                point.z += r * spiral.sin_theta[i];
+                if (reachable_region.contains(point))
+                    ++inside;
+            }
+
+            float disc_area = PI * projectile_radius * projectile_radius;
+            float covered_area = disc_area * static_cast<float>(inside) / spiral.SAMPLES;
+            return std::min(1.f, covered_area / reachable_region.area);
+        }
+
         // Compute intersection area between projectile circle and reachable circle
         float intersection_area = circle_circle_intersection_area(
             cast_position, projectile_radius,
@@ -987,6 +2040,18 @@ namespace HybridPred
         return std::min(1.f, intersection_area / reachable_region.area);
     }
 
+    // Every quality tier is usable from other translation units
+#define HYBRID_PRED_INSTANTIATE_PHYSICS(TIER) \
+    template ReachableRegion PhysicsPredictor::compute_reachable_region<TIER>( \
+        const math::vector3&, const math::vector3&, float, float, float, float); \
+    template float PhysicsPredictor::compute_physics_hit_probability<TIER>( \
+        const math::vector3&, float, const ReachableRegion&);
+
+    HYBRID_PRED_INSTANTIATE_PHYSICS(QualityTier::full)
+    HYBRID_PRED_INSTANTIATE_PHYSICS(QualityTier::reduced)
+    HYBRID_PRED_INSTANTIATE_PHYSICS(QualityTier::minimal)
+#undef HYBRID_PRED_INSTANTIATE_PHYSICS
+
     float PhysicsPredictor::compute_arrival_time(
         const math::vector3& source_pos,
         const math::vector3& target_pos,
@@ -1054,17 +2119,106 @@ namespace HybridPred
         return area;
     }
 
+    float PhysicsPredictor::disk_capsule_intersection_area(
+        const math::vector3& center, float radius,
+        const math::vector3& capsule_start, const math::vector3& capsule_end, float capsule_radius)
+    {
+        if (radius < EPSILON || capsule_radius < EPSILON)
+            return 0.f;
+
+        float sx = capsule_start.x - center.x, sz = capsule_start.z - center.z;
+        float ex = capsule_end.x - center.x, ez = capsule_end.z - center.z;
+        float seg_x = ex - sx, seg_z = ez - sz;
+        float seg_length_sq = seg_x * seg_x + seg_z * seg_z;
+
+        // Disjoint / contained by distance from the disk center to the segment
+        float t = seg_length_sq > EPSILON ? std::clamp(-(sx * seg_x + sz * seg_z) / seg_length_sq, 0.f, 1.f) : 0.f;
+        float axis_distance = std::sqrt((sx + seg_x * t) * (sx + seg_x * t) + (sz + seg_z * t) * (sz + seg_z * t));
+        if (axis_distance >= radius + capsule_radius)
+            return 0.f;
+        if (axis_distance + radius <= capsule_radius)
+            return PI * radius * radius;
+
+        // Axis u and left normal n = (-u.z, u.x); a zero-length capsule is a disk
+        float ux = 1.f, uz = 0.f;
+        if (seg_length_sq > EPSILON)
+        {
+            float inv_length = 1.f / std::sqrt(seg_length_sq);
+            ux = seg_x * inv_length;
+            uz = seg_z * inv_length;
+        }
+        float nx = -uz * capsule_radius, nz = ux * capsule_radius;
+        float axis_angle = std::atan2(uz, ux);
+
+        // CCW loop: right side, end cap, left side, start cap
+        DiskOverlap overlap(radius);
+        overlap.add_segment(sx - nx, sz - nz, ex - nx, ez - nz);
+        overlap.add_arc(ex, ez, capsule_radius, axis_angle - 0.5f * PI, axis_angle + 0.5f * PI);
+        overlap.add_segment(ex + nx, ez + nz, sx + nx, sz + nz);
+        overlap.add_arc(sx, sz, capsule_radius, axis_angle + 0.5f * PI, axis_angle + 1.5f * PI);
+
+        // Same membership rule as point_in_capsule
+        float radius_sq = capsule_radius * capsule_radius;
+        return overlap.area([&](float x, float z) {
+            float t = seg_length_sq > EPSILON ? ((x - sx) * seg_x + (z - sz) * seg_z) / seg_length_sq : 0.f;
+            t = std::clamp(t, 0.f, 1.f);
+            float dx = x - (sx + seg_x * t);
+            float dz = z - (sz + seg_z * t);
+            return dx * dx + dz * dz <= radius_sq;
+        });
+    }
+
+    float PhysicsPredictor::disk_sector_intersection_area(
+        const math::vector3& center, float radius,
+        const math::vector3& sector_origin, const math::vector3& sector_direction,
+        float half_angle, float sector_range)
+    {
+        if (radius < EPSILON || sector_range < EPSILON || half_angle <= 0.f)
+            return 0.f;
+
+        // Half angle >= pi: the sector is the whole range disk
+        if (half_angle >= PI)
+            return circle_circle_intersection_area(center, radius, sector_origin, sector_range);
+
+        float ox = sector_origin.x - center.x, oz = sector_origin.z - center.z;
+        if (ox * ox + oz * oz >= (radius + sector_range) * (radius + sector_range))
+            return 0.f;
+
+        float axis_angle = std::atan2(sector_direction.z, sector_direction.x);
+        float first = axis_angle - half_angle;
+        float last = axis_angle + half_angle;
+
+        // CCW loop: first edge out, range arc, second edge back
+        DiskOverlap overlap(radius);
+        overlap.add_segment(ox, oz, ox + sector_range * std::cos(first), oz + sector_range * std::sin(first));
+        overlap.add_arc(ox, oz, sector_range, first, last);
+        overlap.add_segment(ox + sector_range * std::cos(last), oz + sector_range * std::sin(last), ox, oz);
+
+        // Same membership rule as point_in_cone
+        float cos_half_angle = std::cos(half_angle);
+        float range_sq = sector_range * sector_range;
+        return overlap.area([&](float x, float z) {
+            float dx = x - ox, dz = z - oz;
+            float distance_sq = dx * dx + dz * dz;
+            if (distance_sq > range_sq)
+                return false;
+            float distance = std::sqrt(distance_sq);
+            return distance < EPSILON ||
+                (dx * sector_direction.x + dz * sector_direction.z) >= cos_half_angle * distance;
+        });
+    }
+
     // =========================================================================
     // BEHAVIOR PREDICTOR IMPLEMENTATION
     // =========================================================================
 
-    BehaviorPDF BehaviorPredictor::build_pdf_from_history(
+    const BehaviorPDF& BehaviorPredictor::build_pdf_from_history(
         const TargetBehaviorTracker& tracker,
         float prediction_time,
         float move_speed)
     {
-        BehaviorPDF pdf = tracker.build_behavior_pdf(prediction_time, move_speed);
-        return pdf;
+        // Served from the tracker's per-frame LRU (contextual factors folded in)
+        return tracker.get_behavior_pdf(prediction_time, move_speed);
     }
 
     float BehaviorPredictor::compute_behavior_hit_probability(
@@ -1077,29 +2231,9 @@ namespace HybridPred
         if (pdf.total_probability < EPSILON)
             return 1.0f;
 
-        // Direct grid summation (more accurate than Monte Carlo sampling)
-        // Sum probability mass of all cells whose centers fall inside the hit circle
-        float radius_sq = projectile_radius * projectile_radius;
-        float prob = 0.f;
-
-        for (int x = 0; x < BehaviorPDF::GRID_SIZE; ++x)
-        {
-            for (int z = 0; z < BehaviorPDF::GRID_SIZE; ++z)
-            {
-                // World position of cell center
-                float wx = pdf.origin.x + (x - BehaviorPDF::GRID_SIZE / 2 + 0.5f) * pdf.cell_size;
-                float wz = pdf.origin.z + (z - BehaviorPDF::GRID_SIZE / 2 + 0.5f) * pdf.cell_size;
-
-                // Check if cell center is inside hit circle
-                float dx = wx - cast_position.x;
-                float dz = wz - cast_position.z;
-
-                if (dx * dx + dz * dz <= radius_sq)
-                {
-                    prob += pdf.pdf_grid[x][z];
-                }
-            }
-        }
+        // Summed-area lookup: probability mass of all cells whose centers fall inside
+        // the hit circle, one span per grid row instead of a full 32x32 sweep
+        float prob = pdf.circle_probability(cast_position, projectile_radius);
 
         // PDF is normalized (sums to 1), so this sum is the exact hit probability
         return std::clamp(prob, 0.f, 1.f);
@@ -1113,22 +2247,21 @@ namespace HybridPred
         if (history.empty())
             return math::vector3{};
 
-        const auto& latest = history.back();
+        math::vector3 latest_velocity = history.velocity(history.size() - 1);
 
         // Weighted average of predicted positions
         math::vector3 predicted_pos{};
         float total_weight = 0.f;
 
         // ADAPTIVE DECAY RATE: Adjust based on target mobility
-        float decay_rate = get_adaptive_decay_rate(latest.velocity.magnitude());
+        float decay_rate = get_adaptive_decay_rate(latest_velocity.magnitude());
 
         for (size_t i = 0; i < std::min(history.size(), size_t(20)); ++i)
         {
             size_t idx = history.size() - 1 - i;
-            const auto& snapshot = history[idx];
 
             float weight = std::pow(decay_rate, static_cast<float>(i));
-            predicted_pos = predicted_pos + (snapshot.position + snapshot.velocity * prediction_time) * weight;
+            predicted_pos = predicted_pos + (history.position(idx) + history.velocity(idx) * prediction_time) * weight;
             total_weight += weight;
         }
 
@@ -1160,7 +2293,7 @@ namespace HybridPred
             if (!history.empty())
             {
                 // Strong bias toward current position
-                pdf.add_weighted_sample(history.back().position, 2.0f);
+                pdf.add_weighted_sample(history.position(history.size() - 1), 2.0f);
                 pdf.normalize();
             }
         }
@@ -1188,7 +2321,7 @@ namespace HybridPred
         if (!g_sdk)
         {
             result.is_valid = false;
-            result.reasoning = "SDK not initialized";
+            result.reason = "SDK not initialized";
             return result;
         }
 
@@ -1196,20 +2329,56 @@ namespace HybridPred
         // EDGE CASE DETECTION AND HANDLING
         // =============================================================================
 
-        EdgeCases::EdgeCaseAnalysis edge_cases = EdgeCases::analyze_target(target, source);
+        EdgeCases::EdgeCaseAnalysis edge_cases;
+        {
+            HYBRID_PROFILE_SCOPE(edge_cases);
+            edge_cases = EdgeCases::analyze_target(target, source);
+        }
+        return compute_hybrid_prediction(source, target, spell, tracker, edge_cases);
+    }
+
+    HybridPredictionResult HybridFusionEngine::compute_hybrid_prediction(
+        game_object* source,
+        game_object* target,
+        const pred_sdk::spell_data& spell,
+        TargetBehaviorTracker& tracker,
+        const EdgeCases::EdgeCaseAnalysis& edge_cases)
+    {
+        HYBRID_PROFILE_SPELL_TYPE(spell.spell_type);
+        HYBRID_PROFILE_SCOPE(predict_total);
+        [[maybe_unused]] FrameArena::HeapScope heap_scope;
+
+        // Pipeline instantiation for this call (lower tiers once the frame budget is mostly spent)
+        const QualityTier quality_tier = PredictionBudget::select_tier();
+        PredictionBudget::Scope budget_scope(quality_tier);
+
+        HybridPredictionResult result;
+
+        if (!source || !target || !source->is_valid() || !target->is_valid())
+        {
+            result.is_valid = false;
+            return result;
+        }
+
+        if (!g_sdk)
+        {
+            result.is_valid = false;
+            result.reason = "SDK not initialized";
+            return result;
+        }
 
         // Filter out invalid targets
         if (edge_cases.is_clone)
         {
             result.is_valid = false;
-            result.reasoning = "Target is a clone (Shaco/Wukong/LeBlanc/Neeko)";
+            result.reason = "Target is a clone (Shaco/Wukong/LeBlanc/Neeko)";
             return result;
         }
 
         if (edge_cases.blocked_by_windwall)
         {
             result.is_valid = false;
-            result.reasoning = "Projectile will be blocked by windwall (Yasuo/Samira/Braum)";
+            result.reason = "Projectile will be blocked by windwall (Yasuo/Samira/Braum)";
             return result;
         }
 
@@ -1234,7 +2403,7 @@ namespace HybridPred
             {
                 // Can't time it properly
                 result.is_valid = false;
-                result.reasoning = "Stasis timing impossible - travel time too long";
+                result.reason = "Stasis timing impossible - travel time too long";
                 return result;
             }
 
@@ -1242,7 +2411,9 @@ namespace HybridPred
             {
                 // Need to wait before casting
                 result.is_valid = false;
-                result.reasoning = "Wait " + std::to_string(cast_delay) + "s for stasis exit timing";
+                result.reason = "Wait for stasis exit timing";
+                if (auto* debug = attach_debug(result))
+                    debug->reasoning = "Wait " + std::to_string(cast_delay) + "s for stasis exit timing";
                 return result;
             }
 
@@ -1253,8 +2424,12 @@ namespace HybridPred
             result.behavior_contribution = 1.0f;
             result.confidence_score = 1.0f;
             result.is_valid = true;
-            result.reasoning = "STASIS EXIT PREDICTION - Spell will hit exactly when " +
-                edge_cases.stasis.stasis_type + " ends. GUARANTEED HIT!";
+            result.reason = "STASIS EXIT PREDICTION - GUARANTEED HIT!";
+            if (auto* debug = attach_debug(result))
+            {
+                debug->reasoning = std::string("STASIS EXIT PREDICTION - Spell will hit exactly when ") +
+                    edge_cases.stasis.stasis_type + " ends. GUARANTEED HIT!";
+            }
             return result;
         }
 
@@ -1276,7 +2451,7 @@ namespace HybridPred
             if (!can_interrupt)
             {
                 result.is_valid = false;
-                result.reasoning = "Channel will finish before spell arrives";
+                result.reason = "Channel will finish before spell arrives";
                 return result;
             }
 
@@ -1288,8 +2463,9 @@ namespace HybridPred
             result.confidence_score = 1.0f;
             result.is_valid = true;
 
-            std::string action = edge_cases.channel.is_recalling ? "RECALL" : "CHANNEL";
-            result.reasoning = action + " INTERRUPT - Target is stationary. GUARANTEED HIT!";
+            result.reason = edge_cases.channel.is_recalling ?
+                "RECALL INTERRUPT - Target is stationary. GUARANTEED HIT!" :
+                "CHANNEL INTERRUPT - Target is stationary. GUARANTEED HIT!";
             return result;
         }
 
@@ -1315,69 +2491,42 @@ namespace HybridPred
                 // Spell would arrive BEFORE enemy reaches dash endpoint
                 // Predict at current position with very low confidence
                 result.confidence_score = 0.3f;
-                result.reasoning = "Enemy dashing - spell arrives before dash ends (low confidence)";
+                result.reason = "Enemy dashing - spell arrives before dash ends (low confidence)";
             }
             else
             {
                 // Spell arrives AFTER dash ends - predict at endpoint
                 // This will be used by the spell-specific prediction below
                 // We'll continue to normal prediction but with dash adjustments
-                result.reasoning = "Dash endpoint prediction active";
+                result.reason = "Dash endpoint prediction active";
             }
         }
 
         // =============================================================================
         // AUTOMATIC CONE DETECTION: Check if spell has cone angle defined
-        if (spell.spell_slot >= 0)
-        {
-            spell_entry* spell_entry_ptr = source->get_spell(spell.spell_slot);
-            if (spell_entry_ptr)
-            {
-                auto spell_data = spell_entry_ptr->get_data();
-                if (spell_data)
-                {
-                    auto static_data = spell_data->get_static_data();
-                    if (static_data)
-                    {
-                        float cone_angle = static_data->get_cast_cone_angle();
-                        // If spell has cone angle > 0, it's a cone spell
-                        if (cone_angle > 0.f)
-                        {
-                            return compute_cone_prediction(source, target, spell, tracker, edge_cases);
-                        }
-                    }
-                }
-            }
-        }
+        bool is_cone = has_cast_cone(source, spell);
 
-        // Dispatch to spell-type specific implementation based on pred_sdk type
+        // Dispatch to the shape pipeline instantiated for the selected tier
         HybridPredictionResult spell_result;
 
-        switch (spell.spell_type)
+        switch (quality_tier)
         {
-        case pred_sdk::spell_type::linear:
-            spell_result = compute_linear_prediction(source, target, spell, tracker, edge_cases);
-            break;
-
-        case pred_sdk::spell_type::circular:
-            spell_result = compute_circular_prediction(source, target, spell, tracker, edge_cases);
+        case QualityTier::reduced:
+            spell_result = compute_shape_prediction<QualityTier::reduced>(source, target, spell, tracker, edge_cases, is_cone);
             break;
 
-        case pred_sdk::spell_type::targetted:
-            spell_result = compute_targeted_prediction(source, target, spell, tracker, edge_cases);
-            break;
-
-        case pred_sdk::spell_type::vector:
-            // Vector spells (Viktor E, Rumble R, Irelia E) - two-position optimization
-            spell_result = compute_vector_prediction(source, target, spell, tracker, edge_cases);
+        case QualityTier::minimal:
+            spell_result = compute_shape_prediction<QualityTier::minimal>(source, target, spell, tracker, edge_cases, is_cone);
             break;
 
         default:
-            // Fallback to circular for unknown types
-            spell_result = compute_circular_prediction(source, target, spell, tracker, edge_cases);
+            spell_result = compute_shape_prediction<QualityTier::full>(source, target, spell, tracker, edge_cases, is_cone);
             break;
         }
 
+        if (is_cone)
+            return spell_result;
+
         // Apply edge case adjustments to final result
         if (spell_result.is_valid)
         {
@@ -1389,20 +2538,77 @@ namespace HybridPred
             spell_result.confidence_score = std::clamp(spell_result.confidence_score, 0.f, 1.f);
             spell_result.hit_chance = std::clamp(spell_result.hit_chance, 0.f, 1.f);
 
-            // Add edge case info to reasoning
-            if (edge_cases.is_slowed)
-                spell_result.reasoning += "\n[SLOWED: +15% confidence]";
+            // Add edge case info to reasoning (debug payload only)
+            if (auto* debug = attach_debug(spell_result))
+            {
+                if (edge_cases.is_slowed)
+                    debug->reasoning += "\n[SLOWED: +15% confidence]";
 
-            if (edge_cases.has_shield)
-                spell_result.reasoning += "\n[WARNING: Spell shield active - will be blocked!]";
+                if (edge_cases.has_shield)
+                    debug->reasoning += "\n[WARNING: Spell shield active - will be blocked!]";
 
-            if (edge_cases.dash.is_dashing && !math::is_zero(edge_cases.dash.dash_end_position))
-                spell_result.reasoning += "\n[DASH PREDICTION: Aiming at dash endpoint]";
+                if (edge_cases.dash.is_dashing && !math::is_zero(edge_cases.dash.dash_end_position))
+                    debug->reasoning += "\n[DASH PREDICTION: Aiming at dash endpoint]";
+            }
         }
 
         return spell_result;
     }
 
+    template<QualityTier TIER>
+    HybridPredictionResult HybridFusionEngine::compute_shape_prediction(
+        game_object* source,
+        game_object* target,
+        const pred_sdk::spell_data& spell,
+        TargetBehaviorTracker& tracker,
+        const EdgeCases::EdgeCaseAnalysis& edge_cases,
+        bool is_cone)
+    {
+        if (is_cone)
+            return compute_cone_prediction<TIER>(source, target, spell, tracker, edge_cases);
+
+        // Dispatch to spell-type specific implementation based on pred_sdk type
+        switch (spell.spell_type)
+        {
+        case pred_sdk::spell_type::linear:
+            return compute_linear_prediction<TIER>(source, target, spell, tracker, edge_cases);
+
+        case pred_sdk::spell_type::circular:
+            return compute_circular_prediction<TIER>(source, target, spell, tracker, edge_cases);
+
+        case pred_sdk::spell_type::targetted:
+            return compute_targeted_prediction(source, target, spell, tracker, edge_cases);
+
+        case pred_sdk::spell_type::vector:
+            // Vector spells (Viktor E, Rumble R, Irelia E) - two-position optimization
+            return compute_vector_prediction<TIER>(source, target, spell, tracker, edge_cases);
+
+        default:
+            // Fallback to circular for unknown types
+            return compute_circular_prediction<TIER>(source, target, spell, tracker, edge_cases);
+        }
+    }
+
+    bool HybridFusionEngine::has_cast_cone(game_object* source, const pred_sdk::spell_data& spell)
+    {
+        if (spell.spell_slot < 0)
+            return false;
+
+        spell_entry* spell_entry_ptr = source->get_spell(spell.spell_slot);
+        if (!spell_entry_ptr)
+            return false;
+
+        auto spell_data = spell_entry_ptr->get_data();
+        if (!spell_data)
+            return false;
+
+        auto static_data = spell_data->get_static_data();
+
+        // If spell has cone angle > 0, it's a cone spell
+        return static_data && static_data->get_cast_cone_angle() > 0.f;
+    }
+
+    template<QualityTier TIER>
     HybridPredictionResult HybridFusionEngine::compute_circular_prediction(
         game_object* source,
         game_object* target,
@@ -1424,27 +2630,29 @@ namespace HybridPred
         math::vector3 target_velocity = tracker.get_current_velocity();
         float move_speed = target->get_move_speed();
 
-        ReachableRegion reachable_region = PhysicsPredictor::compute_reachable_region(
+        ReachableRegion reachable_region = PhysicsPredictor::compute_reachable_region<TIER>(
             target->get_position(),
             target_velocity,
             arrival_time,
             move_speed
         );
 
-        result.reachable_region = reachable_region;
-
         // Step 3: Build behavior PDF
-        BehaviorPDF behavior_pdf = BehaviorPredictor::build_pdf_from_history(tracker, arrival_time, move_speed);
-        BehaviorPredictor::apply_contextual_factors(behavior_pdf, tracker, target);
+        const BehaviorPDF& behavior_pdf = BehaviorPredictor::build_pdf_from_history(tracker, arrival_time, move_speed);
 
-        result.behavior_pdf = behavior_pdf;
+        // Debug payload (drawing / analysis only)
+        if (auto* debug = attach_debug(result))
+        {
+            debug->reachable_region = reachable_region;
+            debug->behavior_pdf = behavior_pdf;
+        }
 
         // Step 4: Compute confidence score
         float confidence = compute_confidence_score(source, target, spell, tracker, edge_cases);
         result.confidence_score = confidence;
 
         // Step 5: Find optimal cast position
-        math::vector3 optimal_cast_pos = find_optimal_cast_position(
+        math::vector3 optimal_cast_pos = find_optimal_cast_position<TIER>(
             reachable_region,
             behavior_pdf,
             source->get_position(),
@@ -1455,7 +2663,7 @@ namespace HybridPred
         result.cast_position = optimal_cast_pos;
 
         // Step 6: Evaluate final hit chance at optimal position
-        float physics_prob = PhysicsPredictor::compute_physics_hit_probability(
+        float physics_prob = PhysicsPredictor::compute_physics_hit_probability<TIER>(
             optimal_cast_pos,
             spell.radius,
             reachable_region
@@ -1488,9 +2696,8 @@ namespace HybridPred
         reasoning << "  Confidence: " << (confidence * 100.f) << "%\n";
         reasoning << "  Final HitChance: " << (result.hit_chance * 100.f) << "%\n";
         reasoning << "  Cast Position: (" << optimal_cast_pos.x << ", " << optimal_cast_pos.z << ")\n";
-        result.reasoning = reasoning.str();
-#else
-        result.reasoning = "";
+        if (auto* debug = attach_debug(result))
+            debug->reasoning = reasoning.str();
 #endif
 
         result.is_valid = true;
@@ -1533,7 +2740,7 @@ namespace HybridPred
             constexpr float DIRECTION_TOLERANCE = 0.1f;  // ~5.7 degrees tolerance
             bool is_straight = true;
 
-            math::vector3 base_direction = history[history.size() - 1].velocity;
+            math::vector3 base_direction = history.velocity(history.size() - 1);
             float base_speed = base_direction.magnitude();
 
             // Only consider "straight line" if actually moving
@@ -1543,7 +2750,7 @@ namespace HybridPred
 
                 for (size_t i = history.size() - 5; i < history.size() - 1; ++i)
                 {
-                    math::vector3 vel = history[i].velocity;
+                    math::vector3 vel = history.velocity(i);
                     float speed = vel.magnitude();
 
                     if (speed < 10.f)
@@ -1616,10 +2823,14 @@ namespace HybridPred
         confidence /= mobility_penalty;
 
         // Sample size factor - more data = more confidence
+        // (a champion profile prior stands in for part of the missing history)
         const auto& history = tracker.get_history();
         if (history.size() < MIN_SAMPLES_FOR_BEHAVIOR)
         {
-            confidence *= static_cast<float>(history.size()) / MIN_SAMPLES_FOR_BEHAVIOR;
+            float sample_factor = static_cast<float>(history.size()) / MIN_SAMPLES_FOR_BEHAVIOR;
+            if (tracker.has_profile_prior() && !history.empty())
+                sample_factor = std::max(sample_factor, PROFILE_CONFIDENCE_FLOOR);
+            confidence *= sample_factor;
         }
 
         // Animation lock boost - target is locked in animation
@@ -1632,6 +2843,7 @@ namespace HybridPred
         return std::clamp(confidence, 0.1f, 1.0f);
     }
 
+    template<QualityTier TIER>
     math::vector3 HybridFusionEngine::find_optimal_cast_position(
         const ReachableRegion& reachable_region,
         const BehaviorPDF& behavior_pdf,
@@ -1639,8 +2851,19 @@ namespace HybridPred
         float projectile_radius,
         float confidence)
     {
+        HYBRID_PROFILE_SCOPE(optimizer);
+
+        // The radius-inflation bound needs coverage monotone in the radius, which the
+        // clipped polygon's sampled estimate does not guarantee: dense grid there
+        const auto& config = PredictionConfig::get();
+        if (config.use_branch_and_bound_optimizer && !reachable_region.terrain_clipped)
+        {
+            return find_optimal_cast_position_bnb<TIER>(reachable_region, behavior_pdf,
+                projectile_radius, confidence, config.cast_optimizer_eval_budget / TierParams<TIER>::EVALUATION_DIVISOR);
+        }
+
         // Grid search over reachable region
-        constexpr int GRID_SEARCH_SIZE = 16;
+        constexpr int GRID_SEARCH_SIZE = TierParams<TIER>::GRID_SEARCH_SIZE;
         float best_score = -1.f;
         math::vector3 best_position = reachable_region.center;
 
@@ -1655,7 +2878,7 @@ namespace HybridPred
                 test_pos.x += (i - GRID_SEARCH_SIZE / 2) * step;
                 test_pos.z += (j - GRID_SEARCH_SIZE / 2) * step;
 
-                float score = evaluate_hit_chance_at_point(
+                float score = evaluate_hit_chance_at_point<TIER>(
                     test_pos,
                     reachable_region,
                     behavior_pdf,
@@ -1671,22 +2894,21 @@ namespace HybridPred
             }
         }
 
-        // Gradient ascent refinement (2 iterations)
-        for (int iter = 0; iter < 2; ++iter)
+        // Gradient ascent refinement (2 iterations at full quality)
+        for (int iter = 0; iter < TierParams<TIER>::GRADIENT_ITERATIONS; ++iter)
         {
             constexpr float GRADIENT_STEP = 10.f;
-            constexpr int GRADIENT_SAMPLES = 8;
+            const auto& directions = TierParams<TIER>::GRADIENT;
 
             math::vector3 gradient{};
 
-            for (int i = 0; i < GRADIENT_SAMPLES; ++i)
+            for (int i = 0; i < directions.SAMPLES; ++i)
             {
-                float angle = (2.f * PI * i) / GRADIENT_SAMPLES;
                 math::vector3 test_pos = best_position;
-                test_pos.x += GRADIENT_STEP * std::cos(angle);
-                test_pos.z += GRADIENT_STEP * std::sin(angle);
+                test_pos.x += GRADIENT_STEP * directions.cos_theta[i];
+                test_pos.z += GRADIENT_STEP * directions.sin_theta[i];
 
-                float score = evaluate_hit_chance_at_point(
+                float score = evaluate_hit_chance_at_point<TIER>(
                     test_pos,
                     reachable_region,
                     behavior_pdf,
@@ -1695,14 +2917,14 @@ namespace HybridPred
                 );
 
                 float angle_weight = score - best_score;
-                gradient.x += angle_weight * std::cos(angle);
-                gradient.z += angle_weight * std::sin(angle);
+                gradient.x += angle_weight * directions.cos_theta[i];
+                gradient.z += angle_weight * directions.sin_theta[i];
             }
 
             if (gradient.magnitude() > EPSILON)
             {
                 best_position = best_position + gradient.normalized() * GRADIENT_STEP * 0.5f;
-                best_score = evaluate_hit_chance_at_point(
+                best_score = evaluate_hit_chance_at_point<TIER>(
                     best_position,
                     reachable_region,
                     behavior_pdf,
@@ -1715,6 +2937,115 @@ namespace HybridPred
         return best_position;
     }
 
+    template<QualityTier TIER>
+    math::vector3 HybridFusionEngine::find_optimal_cast_position_bnb(
+        const ReachableRegion& reachable_region,
+        const BehaviorPDF& behavior_pdf,
+        float projectile_radius,
+        float confidence,
+        int max_evaluations)
+    {
+        constexpr int COARSE_SIZE = 4;                  // Coarse pass: 4x4 cells over reachable square
+        constexpr int TOP_K = 4;                        // Coarse cells kept for refinement
+        constexpr float MIN_HALF_WIDTH = 5.f;           // Stop splitting below ~gradient step resolution
+        constexpr float BOUND_TOLERANCE = 1e-4f;        // Ignore improvements smaller than this
+        constexpr float SQRT2 = 1.41421356f;
+
+        struct SearchCell
+        {
+            math::vector3 center;
+            float half_width;
+            float upper_bound;
+
+            bool operator<(const SearchCell& other) const { return upper_bound < other.upper_bound; }
+        };
+
+        int evaluations = 0;
+        math::vector3 best_position = reachable_region.center;
+        float best_score = evaluate_hit_chance_at_point<TIER>(
+            best_position, reachable_region, behavior_pdf, projectile_radius, confidence);
+        ++evaluations;
+
+        // Scores the cell center (candidate) and its upper bound (2 evaluations)
+        auto evaluate_cell = [&](const math::vector3& center, float half_width) -> SearchCell
+        {
+            float score = evaluate_hit_chance_at_point<TIER>(
+                center, reachable_region, behavior_pdf, projectile_radius, confidence);
+            float bound = evaluate_hit_chance_at_point<TIER>(
+                center, reachable_region, behavior_pdf, projectile_radius + half_width * SQRT2, confidence);
+            evaluations += 2;
+
+            if (score > best_score)
+            {
+                best_score = score;
+                best_position = center;
+            }
+
+            return SearchCell{ center, half_width, bound };
+        };
+
+        // Coarse pass
+        FrameVector<SearchCell> frontier(FrameAllocator<SearchCell>::frame());
+        frontier.reserve(COARSE_SIZE * COARSE_SIZE + 3 * max_evaluations / 2);
+
+        float coarse_half_width = reachable_region.max_radius / COARSE_SIZE;
+        for (int i = 0; i < COARSE_SIZE && evaluations + 2 <= max_evaluations; ++i)
+        {
+            for (int j = 0; j < COARSE_SIZE && evaluations + 2 <= max_evaluations; ++j)
+            {
+                math::vector3 center = reachable_region.center;
+                center.x += (2 * i - COARSE_SIZE + 1) * coarse_half_width;
+                center.z += (2 * j - COARSE_SIZE + 1) * coarse_half_width;
+                frontier.push_back(evaluate_cell(center, coarse_half_width));
+            }
+        }
+
+        // Keep only the top-K coarse cells by bound
+        std::make_heap(frontier.begin(), frontier.end());
+        FrameVector<SearchCell> candidates(FrameAllocator<SearchCell>::frame());
+        candidates.reserve(frontier.capacity());
+        for (int k = 0; k < TOP_K && !frontier.empty(); ++k)
+        {
+            std::pop_heap(frontier.begin(), frontier.end());
+            candidates.push_back(frontier.back());
+            frontier.pop_back();
+        }
+        std::make_heap(candidates.begin(), candidates.end());
+
+        // Best-first refinement (quadtree split of the most promising cell)
+        while (!candidates.empty() && evaluations + 8 <= max_evaluations)
+        {
+            std::pop_heap(candidates.begin(), candidates.end());
+            SearchCell cell = candidates.back();
+            candidates.pop_back();
+
+            // Early exit: heap top bounds every remaining cell
+            if (cell.upper_bound <= best_score + BOUND_TOLERANCE)
+                break;
+
+            if (cell.half_width < MIN_HALF_WIDTH)
+                continue;
+
+            float child_half_width = cell.half_width * 0.5f;
+            for (int q = 0; q < 4; ++q)
+            {
+                math::vector3 center = cell.center;
+                center.x += (q & 1) ? child_half_width : -child_half_width;
+                center.z += (q & 2) ? child_half_width : -child_half_width;
+
+                SearchCell child = evaluate_cell(center, child_half_width);
+                if (child.upper_bound > best_score + BOUND_TOLERANCE)
+                {
+                    candidates.push_back(child);
+                    std::push_heap(candidates.begin(), candidates.end());
+                }
+            }
+        }
+
+        return best_position;
+    }
+
+    template<QualityTier TIER>
     float HybridFusionEngine::evaluate_hit_chance_at_point(
         const math::vector3& point,
         const ReachableRegion& reachable_region,
@@ -1722,7 +3053,7 @@ namespace HybridPred
         float projectile_radius,
         float confidence)
     {
-        float physics_prob = PhysicsPredictor::compute_physics_hit_probability(
+        float physics_prob = PhysicsPredictor::compute_physics_hit_probability<TIER>(
             point,
             projectile_radius,
             reachable_region
@@ -1737,10 +3068,20 @@ namespace HybridPred
         return physics_prob * behavior_prob * confidence;
     }
 
+#define HYBRID_PRED_INSTANTIATE_OPTIMIZER(TIER) \
+    template math::vector3 HybridFusionEngine::find_optimal_cast_position<TIER>( \
+        const ReachableRegion&, const BehaviorPDF&, const math::vector3&, float, float);
+
+    HYBRID_PRED_INSTANTIATE_OPTIMIZER(QualityTier::full)
+    HYBRID_PRED_INSTANTIATE_OPTIMIZER(QualityTier::reduced)
+    HYBRID_PRED_INSTANTIATE_OPTIMIZER(QualityTier::minimal)
+#undef HYBRID_PRED_INSTANTIATE_OPTIMIZER
+
     // =========================================================================
     // SPELL-TYPE SPECIFIC IMPLEMENTATIONS
     // =========================================================================
 
+    template<QualityTier TIER>
     HybridPredictionResult HybridFusionEngine::compute_linear_prediction(
         game_object* source,
         game_object* target,
@@ -1760,7 +3101,7 @@ namespace HybridPred
         if (!g_sdk)
         {
             result.is_valid = false;
-            result.reasoning = "SDK not initialized";
+            result.reason = "SDK not initialized";
             return result;
         }
 
@@ -1776,20 +3117,22 @@ namespace HybridPred
         math::vector3 target_velocity = tracker.get_current_velocity();
         float move_speed = target->get_move_speed();
 
-        ReachableRegion reachable_region = PhysicsPredictor::compute_reachable_region(
+        ReachableRegion reachable_region = PhysicsPredictor::compute_reachable_region<TIER>(
             target->get_position(),
             target_velocity,
             arrival_time,
             move_speed
         );
 
-        result.reachable_region = reachable_region;
-
         // Step 3: Build behavior PDF
-        BehaviorPDF behavior_pdf = BehaviorPredictor::build_pdf_from_history(tracker, arrival_time, move_speed);
-        BehaviorPredictor::apply_contextual_factors(behavior_pdf, tracker, target);
+        const BehaviorPDF& behavior_pdf = BehaviorPredictor::build_pdf_from_history(tracker, arrival_time, move_speed);
 
-        result.behavior_pdf = behavior_pdf;
+        // Debug payload (drawing / analysis only)
+        if (auto* debug = attach_debug(result))
+        {
+            debug->reachable_region = reachable_region;
+            debug->behavior_pdf = behavior_pdf;
+        }
 
         // Step 4: Compute confidence score
         float confidence = compute_confidence_score(source, target, spell, tracker, edge_cases);
@@ -1804,7 +3147,7 @@ namespace HybridPred
         if (dist_to_target < MIN_SAFE_DISTANCE)
         {
             result.is_valid = false;
-            result.reasoning = "Target too close - zero distance";
+            result.reason = "Target too close - zero distance";
             return result;
         }
 
@@ -1831,7 +3174,7 @@ namespace HybridPred
         result.cast_position = source->get_position() + optimal_direction * capsule_length;
 
         // Step 6: Compute hit probabilities for capsule
-        float physics_prob = compute_capsule_reachability_overlap(
+        float physics_prob = compute_capsule_reachability_overlap<TIER>(
             capsule_start,
             optimal_direction,
             capsule_length,
@@ -1853,7 +3196,13 @@ namespace HybridPred
         // Weighted geometric fusion (trust physics more when behavior samples are sparse)
         size_t sample_count = tracker.get_history().size();
         result.hit_chance = fuse_probabilities(physics_prob, behavior_prob, confidence, sample_count);
-        result.hit_chance = std::clamp(result.hit_chance, 0.f, 1.f);
+
+        // Step 7: Minions between source and predicted position (unit-colliding skillshots only)
+        bool collides_with_minions = std::find(spell.forbidden_collisions.begin(), spell.forbidden_collisions.end(),
+            pred_sdk::collision_type::unit) != spell.forbidden_collisions.end();
+        float minion_block = EdgeCases::compute_minion_block_probability(
+            capsule_start, reachable_region.center, capsule_radius, collides_with_minions, target);
+        result.hit_chance = std::clamp(result.hit_chance * minion_block, 0.f, 1.f);
 
 #if HYBRID_PRED_ENABLE_REASONING
         // Generate mathematical reasoning
@@ -1866,10 +3215,10 @@ namespace HybridPred
         reasoning << "  Physics Hit Prob: " << (physics_prob * 100.f) << "%\n";
         reasoning << "  Behavior Hit Prob: " << (behavior_prob * 100.f) << "%\n";
         reasoning << "  Confidence: " << (confidence * 100.f) << "%\n";
+        reasoning << "  Minion Block: " << (minion_block * 100.f) << "%\n";
         reasoning << "  Final HitChance: " << (result.hit_chance * 100.f) << "%\n";
-        result.reasoning = reasoning.str();
-#else
-        result.reasoning = "";
+        if (auto* debug = attach_debug(result))
+            debug->reasoning = reasoning.str();
 #endif
 
         result.is_valid = true;
@@ -1901,7 +3250,7 @@ namespace HybridPred
         if (!g_sdk)
         {
             result.is_valid = false;
-            result.reasoning = "SDK not initialized";
+            result.reason = "SDK not initialized";
             return result;
         }
 
@@ -1912,11 +3261,12 @@ namespace HybridPred
         result.behavior_contribution = 1.0f;
         result.confidence_score = compute_confidence_score(source, target, spell, tracker, edge_cases);
         result.is_valid = true;
-        result.reasoning = "Targeted spell - guaranteed hit (unless target becomes untargetable)";
+        result.reason = "Targeted spell - guaranteed hit (unless target becomes untargetable)";
 
         return result;
     }
 
+    template<QualityTier TIER>
     HybridPredictionResult HybridFusionEngine::compute_vector_prediction(
         game_object* source,
         game_object* target,
@@ -1936,7 +3286,7 @@ namespace HybridPred
         if (!g_sdk)
         {
             result.is_valid = false;
-            result.reasoning = "SDK not initialized";
+            result.reason = "SDK not initialized";
             return result;
         }
 
@@ -1952,20 +3302,22 @@ namespace HybridPred
         math::vector3 target_velocity = tracker.get_current_velocity();
         float move_speed = target->get_move_speed();
 
-        ReachableRegion reachable_region = PhysicsPredictor::compute_reachable_region(
+        ReachableRegion reachable_region = PhysicsPredictor::compute_reachable_region<TIER>(
             target->get_position(),
             target_velocity,
             arrival_time,
             move_speed
         );
 
-        result.reachable_region = reachable_region;
-
         // Step 3: Build behavior PDF
-        BehaviorPDF behavior_pdf = BehaviorPredictor::build_pdf_from_history(tracker, arrival_time, move_speed);
-        BehaviorPredictor::apply_contextual_factors(behavior_pdf, tracker, target);
+        const BehaviorPDF& behavior_pdf = BehaviorPredictor::build_pdf_from_history(tracker, arrival_time, move_speed);
 
-        result.behavior_pdf = behavior_pdf;
+        // Debug payload (drawing / analysis only)
+        if (auto* debug = attach_debug(result))
+        {
+            debug->reachable_region = reachable_region;
+            debug->behavior_pdf = behavior_pdf;
+        }
 
         // Step 4: Compute confidence score
         float confidence = compute_confidence_score(source, target, spell, tracker, edge_cases);
@@ -1974,7 +3326,7 @@ namespace HybridPred
         // Step 5: Optimize vector orientation
         // Test multiple orientations to find best two-position configuration
         size_t sample_count = tracker.get_history().size();
-        VectorConfiguration best_config = optimize_vector_orientation(
+        VectorConfiguration best_config = optimize_vector_orientation<TIER>(
             source,
             reachable_region.center,
             reachable_region,
@@ -2007,9 +3359,8 @@ namespace HybridPred
         reasoning << "  Behavior Hit Prob: " << (best_config.behavior_prob * 100.f) << "%\n";
         reasoning << "  Confidence: " << (confidence * 100.f) << "%\n";
         reasoning << "  Final HitChance: " << (result.hit_chance * 100.f) << "%\n";
-        result.reasoning = reasoning.str();
-#else
-        result.reasoning = "";
+        if (auto* debug = attach_debug(result))
+            debug->reasoning = reasoning.str();
 #endif
 
         result.is_valid = true;
@@ -2020,6 +3371,7 @@ namespace HybridPred
         return result;
     }
 
+    template<QualityTier TIER>
     HybridPredictionResult HybridFusionEngine::compute_cone_prediction(
         game_object* source,
         game_object* target,
@@ -2039,7 +3391,7 @@ namespace HybridPred
         if (!g_sdk)
         {
             result.is_valid = false;
-            result.reasoning = "SDK not initialized";
+            result.reason = "SDK not initialized";
             return result;
         }
 
@@ -2055,20 +3407,22 @@ namespace HybridPred
         math::vector3 target_velocity = tracker.get_current_velocity();
         float move_speed = target->get_move_speed();
 
-        ReachableRegion reachable_region = PhysicsPredictor::compute_reachable_region(
+        ReachableRegion reachable_region = PhysicsPredictor::compute_reachable_region<TIER>(
             target->get_position(),
             target_velocity,
             arrival_time,
             move_speed
         );
 
-        result.reachable_region = reachable_region;
-
         // Step 3: Build behavior PDF
-        BehaviorPDF behavior_pdf = BehaviorPredictor::build_pdf_from_history(tracker, arrival_time, move_speed);
-        BehaviorPredictor::apply_contextual_factors(behavior_pdf, tracker, target);
+        const BehaviorPDF& behavior_pdf = BehaviorPredictor::build_pdf_from_history(tracker, arrival_time, move_speed);
 
-        result.behavior_pdf = behavior_pdf;
+        // Debug payload (drawing / analysis only)
+        if (auto* debug = attach_debug(result))
+        {
+            debug->reachable_region = reachable_region;
+            debug->behavior_pdf = behavior_pdf;
+        }
 
         // Step 4: Compute confidence score
         float confidence = compute_confidence_score(source, target, spell, tracker, edge_cases);
@@ -2093,7 +3447,7 @@ namespace HybridPred
         if (dist_to_center < MIN_SAFE_DISTANCE)
         {
             result.is_valid = false;
-            result.reasoning = "Target too close - zero distance";
+            result.reason = "Target too close - zero distance";
             return result;
         }
 
@@ -2101,7 +3455,7 @@ namespace HybridPred
         result.cast_position = source->get_position() + direction * cone_range;
 
         // Step 6: Compute hit probabilities for cone
-        float physics_prob = compute_cone_reachability_overlap(
+        float physics_prob = compute_cone_reachability_overlap<TIER>(
             source->get_position(),
             direction,
             cone_half_angle,
@@ -2137,9 +3491,8 @@ namespace HybridPred
         reasoning << "  Behavior Hit Prob: " << (behavior_prob * 100.f) << "%\n";
         reasoning << "  Confidence: " << (confidence * 100.f) << "%\n";
         reasoning << "  Final HitChance: " << (result.hit_chance * 100.f) << "%\n";
-        result.reasoning = reasoning.str();
-#else
-        result.reasoning = "";
+        if (auto* debug = attach_debug(result))
+            debug->reasoning = reasoning.str();
 #endif
 
         result.is_valid = true;
@@ -2151,45 +3504,340 @@ namespace HybridPred
     }
 
     // =========================================================================
-    // GEOMETRY HELPERS FOR SPELL SHAPES
+    // MULTI-TARGET AOE OPTIMIZATION
     // =========================================================================
 
-    bool HybridFusionEngine::point_in_capsule(
-        const math::vector3& point,
-        const math::vector3& capsule_start,
-        const math::vector3& capsule_end,
-        float capsule_radius)
+    AoePredictionResult HybridFusionEngine::compute_aoe_prediction(
+        game_object* source,
+        const std::vector<AoeTargetInput>& targets,
+        const pred_sdk::spell_data& spell,
+        int min_hits)
     {
-        // Capsule = line segment + radius
-        // Point is inside if distance to line segment ≤ radius
+        AoePredictionResult result;
 
-        math::vector3 segment = capsule_end - capsule_start;
-        math::vector3 to_point = point - capsule_start;
+        if (!source || !source->is_valid())
+        {
+            result.reason = "Invalid source";
+            return result;
+        }
 
-        float segment_length_sq = segment.x * segment.x + segment.z * segment.z;
+        if (!g_sdk)
+        {
+            result.reason = "SDK not initialized";
+            return result;
+        }
 
-        if (segment_length_sq < EPSILON)
+        const bool is_cone = has_cast_cone(source, spell);
+        const bool directional = is_cone || spell.spell_type == pred_sdk::spell_type::linear;
+        if (!directional && spell.spell_type != pred_sdk::spell_type::circular)
         {
-            // Degenerate case: start == end (treat as sphere)
-            float dist_sq = to_point.x * to_point.x + to_point.z * to_point.z;
-            return dist_sq <= capsule_radius * capsule_radius;
+            result.reason = "AoE search supports circular, linear and cone spells";
+            return result;
         }
 
-        // Project point onto line segment (clamped to [0, 1])
-        float t = (to_point.x * segment.x + to_point.z * segment.z) / segment_length_sq;
-        t = std::clamp(t, 0.f, 1.f);
+        const auto& config = PredictionConfig::get();
+        const math::vector3 source_pos = source->get_position();
+        const float cone_half_angle = std::atan2(spell.radius, spell.range);  // Same convention as compute_cone_prediction
+        min_hits = std::max(min_hits, 1);
 
-        // Closest point on segment
-        math::vector3 closest = capsule_start + segment * t;
+        // Step 1: Per-target state, computed once and shared by every candidate
+        struct TargetState
+        {
+            ReachableRegion region;
+            const BehaviorPDF* pdf;
+            float confidence;            // Edge case multiplier folded in
+            size_t sample_count;
+        };
 
-        // Distance from point to closest point on segment
-        float dx = point.x - closest.x;
-        float dz = point.z - closest.z;
-        float dist_sq = dx * dx + dz * dz;
+        FrameVector<TargetState> states(FrameAllocator<TargetState>::frame());
+        states.reserve(targets.size());
+        result.targets.reserve(targets.size());
 
-        return dist_sq <= capsule_radius * capsule_radius;
-    }
+        for (const AoeTargetInput& input : targets)
+        {
+            game_object* target = input.target;
+            if (!target || !target->is_valid() || !input.tracker)
+                continue;
+
+            const EdgeCases::EdgeCaseAnalysis& edge_cases = input.edge_cases;
+            if (edge_cases.is_clone || edge_cases.blocked_by_windwall || edge_cases.stasis.is_in_stasis)
+                continue;
+
+            TargetBehaviorTracker& tracker = *input.tracker;
+
+            float arrival_time = PhysicsPredictor::compute_arrival_time(
+                source_pos,
+                target->get_position(),
+                spell.projectile_speed,
+                spell.delay
+            );
+
+            float move_speed = target->get_move_speed();
+
+            TargetState state;
+            state.region = PhysicsPredictor::compute_reachable_region(
+                target->get_position(),
+                tracker.get_current_velocity(),
+                arrival_time,
+                move_speed
+            );
+            state.pdf = &BehaviorPredictor::build_pdf_from_history(tracker, arrival_time, move_speed);
+            state.confidence = std::clamp(
+                compute_confidence_score(source, target, spell, tracker, edge_cases) * edge_cases.confidence_multiplier,
+                0.f, 1.f);
+            state.sample_count = tracker.get_history().size();
+
+            states.push_back(std::move(state));
+            result.targets.push_back(AoeTargetHit{ target, 0.f });
+        }
+
+        if (states.size() < static_cast<size_t>(min_hits))
+        {
+            result.reason = "Fewer eligible targets than min_hits";
+            return result;
+        }
+
+        HYBRID_PROFILE_SCOPE(optimizer);
+
+        auto direction_to = [&](const math::vector3& point)
+        {
+            math::vector3 to_point = point - source_pos;
+            float length = std::sqrt(to_point.x * to_point.x + to_point.z * to_point.z);
+            return length > 1.f ? math::vector3(to_point.x / length, 0.f, to_point.z / length) : math::vector3(0.f, 0.f, 1.f);
+        };
+
+        // Circle centers stay within cast range; directional casts sit at full range
+        auto make_candidate = [&](const math::vector3& point)
+        {
+            math::vector3 direction = direction_to(point);
+            if (directional)
+                return source_pos + direction * spell.range;
+
+            float dx = point.x - source_pos.x;
+            float dz = point.z - source_pos.z;
+            if (spell.range > 0.f && dx * dx + dz * dz > spell.range * spell.range)
+                return source_pos + direction * spell.range;
+            return point;
+        };
+
+        // Conservative shape test against the whole reachable disc (never rejects a hittable target)
+        auto can_hit = [&](const TargetState& state, const math::vector3& cast, const math::vector3& direction)
+        {
+            float slack = state.region.max_radius;
+            if (!directional)
+                return cast.distance(state.region.center) <= spell.radius + slack;
+
+            float rx = state.region.center.x - source_pos.x;
+            float rz = state.region.center.z - source_pos.z;
+            float along = rx * direction.x + rz * direction.z;
+            float across = std::abs(rx * direction.z - rz * direction.x);
+
+            if (is_cone)
+            {
+                return along >= -slack && along <= spell.range + slack &&
+                    across <= std::max(along, 0.f) * std::tan(cone_half_angle) + slack / std::cos(cone_half_angle);
+            }
+
+            return along >= -(spell.radius + slack) && along <= spell.range + spell.radius + slack &&
+                across <= spell.radius + slack;
+        };
+
+        auto score = [&](const TargetState& state, const math::vector3& cast, const math::vector3& direction)
+        {
+            float physics_prob;
+            float behavior_prob;
+            if (!directional)
+            {
+                physics_prob = PhysicsPredictor::compute_physics_hit_probability(cast, spell.radius, state.region);
+                behavior_prob = BehaviorPredictor::compute_behavior_hit_probability(cast, spell.radius, *state.pdf);
+            }
+            else if (is_cone)
+            {
+                physics_prob = compute_cone_reachability_overlap(source_pos, direction, cone_half_angle, spell.range, state.region);
+                behavior_prob = compute_cone_behavior_probability(source_pos, direction, cone_half_angle, spell.range, *state.pdf);
+            }
+            else
+            {
+                physics_prob = compute_capsule_reachability_overlap(source_pos, direction, spell.range, spell.radius, state.region);
+                behavior_prob = compute_capsule_behavior_probability(source_pos, direction, spell.range, spell.radius, *state.pdf);
+            }
+
+            return std::clamp(fuse_probabilities(physics_prob, behavior_prob, state.confidence, state.sample_count), 0.f, 1.f);
+        };
+
+        // Step 2: Evaluate a candidate; false if pruned (cannot make min_hits or beat best_expected)
+        FrameVector<uint8_t> possible(states.size(), 0, FrameAllocator<uint8_t>::frame());
+        auto evaluate = [&](const math::vector3& cast, float best_expected, float& expected, int& hits)
+        {
+            math::vector3 direction = direction_to(cast);
+
+            int possible_count = 0;
+            float bound = 0.f;
+            for (size_t i = 0; i < states.size(); ++i)
+            {
+                possible[i] = can_hit(states[i], cast, direction);
+                if (possible[i])
+                {
+                    ++possible_count;
+                    bound += states[i].confidence;  // fused hit chance <= confidence
+                }
+            }
+
+            if (possible_count < min_hits || bound <= best_expected)
+                return false;
+
+            expected = 0.f;
+            hits = 0;
+            for (size_t i = 0; i < states.size(); ++i)
+            {
+                if (!possible[i])
+                    continue;
+
+                float hit_chance = score(states[i], cast, direction);
+                expected += hit_chance;
+                if (hit_chance >= config.aoe_hit_threshold)
+                    ++hits;
+
+                --possible_count;
+                bound -= states[i].confidence;
+                if (hits + possible_count < min_hits || expected + bound <= best_expected)
+                    return false;
+            }
+
+            return true;
+        };
+
+        // Step 3: Seeds - each predicted center plus every pairwise midpoint (circle) / bisector (direction)
+        FrameVector<math::vector3> seeds(FrameAllocator<math::vector3>::frame());
+        seeds.reserve(states.size() * (states.size() + 1) / 2);
+        for (size_t i = 0; i < states.size(); ++i)
+        {
+            seeds.push_back(make_candidate(states[i].region.center));
+            for (size_t j = i + 1; j < states.size(); ++j)
+            {
+                if (directional)
+                {
+                    math::vector3 bisector = direction_to(states[i].region.center) + direction_to(states[j].region.center);
+                    seeds.push_back(make_candidate(source_pos + bisector * spell.range));
+                }
+                else
+                {
+                    seeds.push_back(make_candidate((states[i].region.center + states[j].region.center) * 0.5f));
+                }
+            }
+        }
+
+        bool found = false;
+        math::vector3 best_cast{};
+        float best_expected = 0.f;
+        int best_hits = 0;
+
+        auto try_candidate = [&](const math::vector3& cast)
+        {
+            float expected = 0.f;
+            int hits = 0;
+            if (evaluate(cast, best_expected, expected, hits))
+            {
+                found = true;
+                best_cast = cast;
+                best_expected = expected;
+                best_hits = hits;
+            }
+        };
+
+        for (const math::vector3& seed : seeds)
+            try_candidate(seed);
+
+        if (!found)
+        {
+            result.reason = "No cast can reach min_hits";
+            return result;
+        }
+
+        // Step 4: Pattern search around the best seed (8 offsets / 2 rotations per step)
+        float step = directional
+            ? (is_cone ? cone_half_angle : std::atan2(spell.radius, std::max(spell.range, 1.f))) * 0.5f
+            : spell.radius * 0.5f;
+
+        for (int iteration = 0; iteration < config.aoe_refine_iterations; ++iteration, step *= 0.5f)
+        {
+            math::vector3 center = best_cast;
+            if (directional)
+            {
+                math::vector3 direction = direction_to(center);
+                for (float angle : { step, -step })
+                {
+                    float c = std::cos(angle);
+                    float s = std::sin(angle);
+                    math::vector3 rotated(direction.x * c - direction.z * s, 0.f, direction.x * s + direction.z * c);
+                    try_candidate(source_pos + rotated * spell.range);
+                }
+                continue;
+            }
+
+            for (int k = 0; k < 8; ++k)
+            {
+                float angle = k * (PI / 4.f);
+                try_candidate(make_candidate(center + math::vector3(std::cos(angle) * step, 0.f, std::sin(angle) * step)));
+            }
+        }
+
+        // Step 5: Per-target hit chances at the chosen cast
+        math::vector3 best_direction = direction_to(best_cast);
+        for (size_t i = 0; i < states.size(); ++i)
+        {
+            if (can_hit(states[i], best_cast, best_direction))
+                result.targets[i].hit_chance = score(states[i], best_cast, best_direction);
+        }
+
+        result.cast_position = best_cast;
+        result.expected_hits = best_expected;
+        result.hit_count = best_hits;
+        result.is_valid = true;
+        return result;
+    }
+
+    // =========================================================================
+    // GEOMETRY HELPERS FOR SPELL SHAPES
+    // =========================================================================
+
+    bool HybridFusionEngine::point_in_capsule(
+        const math::vector3& point,
+        const math::vector3& capsule_start,
+        const math::vector3& capsule_end,
+        float capsule_radius)
+    {
+        // Capsule = line segment + radius
+        // Point is inside if distance to line segment ≤ radius
+
+        math::vector3 segment = capsule_end - capsule_start;
+        math::vector3 to_point = point - capsule_start;
+
+        float segment_length_sq = segment.x * segment.x + segment.z * segment.z;
+
+        if (segment_length_sq < EPSILON)
+        {
+            // Degenerate case: start == end (treat as sphere)
+            float dist_sq = to_point.x * to_point.x + to_point.z * to_point.z;
+            return dist_sq <= capsule_radius * capsule_radius;
+        }
+
+        // Project point onto line segment (clamped to [0, 1])
+        float t = (to_point.x * segment.x + to_point.z * segment.z) / segment_length_sq;
+        t = std::clamp(t, 0.f, 1.f);
+
+        // Closest point on segment
+        math::vector3 closest = capsule_start + segment * t;
+
+        // Distance from point to closest point on segment
+        float dx = point.x - closest.x;
+        float dz = point.z - closest.z;
+        float dist_sq = dx * dx + dz * dz;
+
+        return dist_sq <= capsule_radius * capsule_radius;
+    }
 
+    template<QualityTier TIER>
     float HybridFusionEngine::compute_capsule_reachability_overlap(
         const math::vector3& capsule_start,
         const math::vector3& capsule_direction,
@@ -2197,35 +3845,43 @@ namespace HybridPred
         float capsule_radius,
         const ReachableRegion& reachable_region)
     {
-        // Quasi-Monte Carlo integration: Sample points in reachable circle using Fermat spiral,
-        // count how many fall inside capsule (deterministic low-discrepancy sampling)
+        // Fraction of the reachable disk inside the capsule: closed form by default,
+        // quasi-Monte Carlo over the Fermat spiral for validation and wall-clipped regions
 
         if (reachable_region.area < EPSILON)
             return 0.f;
 
         math::vector3 capsule_end = capsule_start + capsule_direction * capsule_length;
+        math::vector3 segment = capsule_end - capsule_start;
 
-        constexpr int SAMPLES = 128;
-        constexpr float SPIRAL_FACTOR = 7.f;  // Coprime with SAMPLES for uniform coverage
-        int hits = 0;
-
-        for (int i = 0; i < SAMPLES; ++i)
+        if (PredictionConfig::get().use_analytic_reachability && !reachable_region.terrain_clipped)
         {
-            // Fermat spiral: uniform area distribution in reachable disk
-            float r = reachable_region.max_radius * std::sqrt(static_cast<float>(i) / SAMPLES);
-            float theta = (2.f * PI * i) / SAMPLES * SPIRAL_FACTOR;  // 7 is coprime with 128
-
-            math::vector3 sample_point = reachable_region.center;
-            sample_point.x += r * std::cos(theta);
-            sample_point.z += r * std::sin(theta);
-
-            if (point_in_capsule(sample_point, capsule_start, capsule_end, capsule_radius))
-            {
-                ++hits;
-            }
+            float disk_radius = reachable_region.max_radius;
+            float overlap_area = PhysicsPredictor::disk_capsule_intersection_area(
+                reachable_region.center, disk_radius, capsule_start, capsule_end, capsule_radius);
+            return std::clamp(overlap_area / (PI * disk_radius * disk_radius), 0.f, 1.f);
         }
 
-        return static_cast<float>(hits) / SAMPLES;
+        // Same test as point_in_capsule, evaluated over the spiral in SIMD lanes
+        SIMD::CapsuleParams capsule;
+        capsule.start_x = capsule_start.x;
+        capsule.start_z = capsule_start.z;
+        capsule.seg_x = segment.x;
+        capsule.seg_z = segment.z;
+        capsule.seg_length_sq = segment.x * segment.x + segment.z * segment.z;
+        capsule.radius_sq = capsule_radius * capsule_radius;
+
+        // Fermat spiral: uniform area distribution in reachable disk
+        const auto& spiral = TierParams<TIER>::SPIRAL;
+        if (reachable_region.terrain_clipped)
+            return clipped_region_overlap<TIER>(reachable_region, [&](const math::vector3& point) {
+                return point_in_capsule(point, capsule_start, capsule_end, capsule_radius);
+            });
+
+        int hits = SIMD::count_disk_samples_in_capsule(make_disk_table(spiral),
+            reachable_region.center.x, reachable_region.center.z, reachable_region.max_radius, capsule);
+
+        return static_cast<float>(hits) / spiral.SAMPLES;
     }
 
     float HybridFusionEngine::compute_capsule_behavior_probability(
@@ -2238,27 +3894,9 @@ namespace HybridPred
         if (pdf.total_probability < EPSILON)
             return 1.0f;  // Neutral fallback
 
-        // Direct grid summation (more accurate than sampling)
-        // Sum probability mass of all cells whose centers fall inside the capsule
-        math::vector3 capsule_end = capsule_start + capsule_direction * capsule_length;
-        float prob = 0.f;
-
-        for (int x = 0; x < BehaviorPDF::GRID_SIZE; ++x)
-        {
-            for (int z = 0; z < BehaviorPDF::GRID_SIZE; ++z)
-            {
-                // World position of cell center
-                float wx = pdf.origin.x + (x - BehaviorPDF::GRID_SIZE / 2 + 0.5f) * pdf.cell_size;
-                float wz = pdf.origin.z + (z - BehaviorPDF::GRID_SIZE / 2 + 0.5f) * pdf.cell_size;
-                math::vector3 cell_center(wx, pdf.origin.y, wz);
-
-                // Check if cell center is inside capsule
-                if (point_in_capsule(cell_center, capsule_start, capsule_end, capsule_radius))
-                {
-                    prob += pdf.pdf_grid[x][z];
-                }
-            }
-        }
+        // Summed-area lookup: probability mass of all cells whose centers fall inside
+        // the capsule (oriented strip with round caps), one span per grid row
+        float prob = pdf.strip_probability(capsule_start, capsule_direction, capsule_length, capsule_radius);
 
         // PDF is normalized (sums to 1), so this sum is the exact hit probability
         return std::clamp(prob, 0.f, 1.f);
@@ -2303,6 +3941,7 @@ namespace HybridPred
         return cos_angle >= cos_half_angle;
     }
 
+    template<QualityTier TIER>
     float HybridFusionEngine::compute_cone_reachability_overlap(
         const math::vector3& cone_origin,
         const math::vector3& cone_direction,
@@ -2310,33 +3949,34 @@ namespace HybridPred
         float cone_range,
         const ReachableRegion& reachable_region)
     {
-        // Quasi-Monte Carlo integration: Sample points in reachable circle using Fermat spiral,
-        // count how many fall inside cone (deterministic low-discrepancy sampling)
+        // Fraction of the reachable disk inside the cone: closed form by default,
+        // quasi-Monte Carlo over the Fermat spiral for validation and wall-clipped regions
 
         if (reachable_region.area < EPSILON)
             return 0.f;
 
-        constexpr int SAMPLES = 128;
-        constexpr float SPIRAL_FACTOR = 7.f;  // Coprime with SAMPLES for uniform coverage
-        int hits = 0;
-
-        for (int i = 0; i < SAMPLES; ++i)
+        if (PredictionConfig::get().use_analytic_reachability && !reachable_region.terrain_clipped)
         {
-            // Fermat spiral: uniform area distribution in reachable disk
-            float r = reachable_region.max_radius * std::sqrt(static_cast<float>(i) / SAMPLES);
-            float theta = (2.f * PI * i) / SAMPLES * SPIRAL_FACTOR;  // 7 is coprime with 128
+            float disk_radius = reachable_region.max_radius;
+            float overlap_area = PhysicsPredictor::disk_sector_intersection_area(
+                reachable_region.center, disk_radius, cone_origin, cone_direction, cone_half_angle, cone_range);
+            return std::clamp(overlap_area / (PI * disk_radius * disk_radius), 0.f, 1.f);
+        }
 
-            math::vector3 sample_point = reachable_region.center;
-            sample_point.x += r * std::cos(theta);
-            sample_point.z += r * std::sin(theta);
+        // Same test as point_in_cone, evaluated over the spiral in SIMD lanes
+        SIMD::ConeParams cone = make_cone_params(cone_origin, cone_direction, cone_half_angle, cone_range);
 
-            if (point_in_cone(sample_point, cone_origin, cone_direction, cone_half_angle, cone_range))
-            {
-                ++hits;
-            }
-        }
+        // Fermat spiral: uniform area distribution in reachable disk
+        const auto& spiral = TierParams<TIER>::SPIRAL;
+        if (reachable_region.terrain_clipped)
+            return clipped_region_overlap<TIER>(reachable_region, [&](const math::vector3& point) {
+                return point_in_cone(point, cone_origin, cone_direction, cone_half_angle, cone_range);
+            });
+
+        int hits = SIMD::count_disk_samples_in_cone(make_disk_table(spiral),
+            reachable_region.center.x, reachable_region.center.z, reachable_region.max_radius, cone);
 
-        return static_cast<float>(hits) / SAMPLES;
+        return static_cast<float>(hits) / spiral.SAMPLES;
     }
 
     float HybridFusionEngine::compute_cone_behavior_probability(
@@ -2349,26 +3989,9 @@ namespace HybridPred
         if (pdf.total_probability < EPSILON)
             return 1.0f;  // Neutral fallback
 
-        // Direct grid summation (more accurate than sampling)
-        // Sum probability mass of all cells whose centers fall inside the cone
-        float prob = 0.f;
-
-        for (int x = 0; x < BehaviorPDF::GRID_SIZE; ++x)
-        {
-            for (int z = 0; z < BehaviorPDF::GRID_SIZE; ++z)
-            {
-                // World position of cell center
-                float wx = pdf.origin.x + (x - BehaviorPDF::GRID_SIZE / 2 + 0.5f) * pdf.cell_size;
-                float wz = pdf.origin.z + (z - BehaviorPDF::GRID_SIZE / 2 + 0.5f) * pdf.cell_size;
-                math::vector3 cell_center(wx, pdf.origin.y, wz);
-
-                // Check if cell center is inside cone
-                if (point_in_cone(cell_center, cone_origin, cone_direction, cone_half_angle, cone_range))
-                {
-                    prob += pdf.pdf_grid[x][z];
-                }
-            }
-        }
+        // Mass of all cells whose centers fall inside the cone: one summed-area
+        // table span per grid row instead of a per-cell sweep
+        float prob = pdf.cone_probability(cone_origin, cone_direction, cone_half_angle, cone_range);
 
         // PDF is normalized (sums to 1), so this sum is the exact hit probability
         return std::clamp(prob, 0.f, 1.f);
@@ -2378,6 +4001,7 @@ namespace HybridPred
     // VECTOR SPELL OPTIMIZATION HELPERS
     // =========================================================================
 
+    template<QualityTier TIER>
     HybridFusionEngine::VectorConfiguration HybridFusionEngine::optimize_vector_orientation(
         game_object* source,
         const math::vector3& predicted_target_pos,
@@ -2407,8 +4031,18 @@ namespace HybridPred
          *    c. Verify first_cast is within cast_range
          *    d. Compute hit probability using capsule geometry
          * 3. Return configuration with highest hit_chance
+         *
+         * Polar mode (PredictionConfig::use_polar_vector_search), same result:
+         * 1. Score every pulled-back (non-centered) table placement directly
+         * 2. Bound each centered table line from one target-centered polar projection
+         *    (OrientationHistogram; closed-form disk / band areas for the analytic
+         *    reachability fraction)
+         * 3. Evaluate centered lines exactly in descending bound order, stopping once
+         *    no remaining bound reaches the best score (ties keep the lowest index)
          */
 
+        HYBRID_PROFILE_SCOPE(optimizer);
+
         VectorConfiguration best_config;
         best_config.hit_chance = 0.f;
 
@@ -2425,41 +4059,44 @@ namespace HybridPred
         math::vector3 to_predicted = predicted_target_pos - source_pos;
         float dist_to_predicted = to_predicted.magnitude();
 
-        // Test multiple orientations
-        constexpr int NUM_ORIENTATIONS = 20;
-
-        for (int i = 0; i < NUM_ORIENTATIONS; ++i)
+        // Place a line along direction: centered on the predicted target, or pulled
+        // back toward the source when first_cast would be out of range.
+        // Returns false for the pulled-back placement.
+        auto place = [&](const math::vector3& direction, math::vector3& first_cast, math::vector3& second_cast)
         {
-            float angle = (2.f * PI * i) / NUM_ORIENTATIONS;
-            math::vector3 direction(std::cos(angle), 0.f, std::sin(angle));
-
             // Position vector line centered on predicted target
             // Line goes from (target - dir*length/2) to (target + dir*length/2)
-            math::vector3 first_cast = predicted_target_pos - direction * (vector_length * 0.5f);
-            math::vector3 second_cast = predicted_target_pos + direction * (vector_length * 0.5f);
+            first_cast = predicted_target_pos - direction * (vector_length * 0.5f);
+            second_cast = predicted_target_pos + direction * (vector_length * 0.5f);
 
             // Check if first_cast is within range from source
             float distance_to_first_cast = (first_cast - source_pos).magnitude();
-            if (distance_to_first_cast > max_first_cast_range)
+            if (distance_to_first_cast <= max_first_cast_range)
+                return true;
+
+            // Adjust: Move line closer to source while maintaining orientation
+            // Place first_cast at max_first_cast_range in direction of predicted target
+            if (dist_to_predicted > EPSILON)
             {
-                // Adjust: Move line closer to source while maintaining orientation
-                // Place first_cast at max_first_cast_range in direction of predicted target
-                if (dist_to_predicted > EPSILON)
-                {
-                    math::vector3 to_target = to_predicted / dist_to_predicted;  // Safe manual normalize
-                    first_cast = source_pos + to_target * max_first_cast_range;
-                    second_cast = first_cast + direction * vector_length;
-                }
-                else
-                {
-                    // Target too close - use default forward direction
-                    first_cast = source_pos + direction * std::min(max_first_cast_range, vector_length * 0.5f);
-                    second_cast = first_cast + direction * vector_length;
-                }
+                math::vector3 to_target = to_predicted / dist_to_predicted;  // Safe manual normalize
+                first_cast = source_pos + to_target * max_first_cast_range;
+                second_cast = first_cast + direction * vector_length;
             }
+            else
+            {
+                // Target too close - use default forward direction
+                first_cast = source_pos + direction * std::min(max_first_cast_range, vector_length * 0.5f);
+                second_cast = first_cast + direction * vector_length;
+            }
+            return false;
+        };
 
+        const auto& orientations = TierParams<TIER>::ORIENTATIONS;
+        int best_index = orientations.SAMPLES;
+        auto consider = [&](int index, const math::vector3& direction, const math::vector3& first_cast, const math::vector3& second_cast)
+        {
             // Compute hit probability for this configuration
-            float physics_prob = compute_capsule_reachability_overlap(
+            float physics_prob = compute_capsule_reachability_overlap<TIER>(
                 first_cast,
                 direction,
                 vector_length,
@@ -2478,15 +4115,199 @@ namespace HybridPred
             // Weighted geometric fusion (trust physics more when behavior samples are sparse)
             float hit_chance = fuse_probabilities(physics_prob, behavior_prob, confidence, sample_count);
 
-            // Update best configuration
-            if (hit_chance > best_config.hit_chance)
+            // Update best configuration (ties go to the lowest table index, as in table order)
+            if (hit_chance > best_config.hit_chance ||
+                (hit_chance == best_config.hit_chance && hit_chance > 0.f && index < best_index))
             {
+                best_index = index;
                 best_config.first_cast_position = first_cast;
                 best_config.cast_position = second_cast;
                 best_config.hit_chance = hit_chance;
                 best_config.physics_prob = physics_prob;
                 best_config.behavior_prob = behavior_prob;
             }
+        };
+
+        math::vector3 first_cast;
+        math::vector3 second_cast;
+
+        // Polar mode bounds centered lines only; pulled-back placements are always
+        // scored directly (first pass), like every line in the table loop
+        bool polar_search = PredictionConfig::get().use_polar_vector_search &&
+            !reachable_region.terrain_clipped && vector_length > EPSILON && vector_width > 0.f;
+
+        int centered[TierParams<TIER>::ORIENTATIONS.SAMPLES];
+        int centered_count = 0;
+
+        // Test multiple orientations
+        for (int i = 0; i < orientations.SAMPLES; ++i)
+        {
+            math::vector3 direction(orientations.cos_theta[i], 0.f, orientations.sin_theta[i]);
+            if (place(direction, first_cast, second_cast) && polar_search)
+                centered[centered_count++] = i;
+            else
+                consider(i, direction, first_cast, second_cast);
+        }
+
+        // Below MIN_BOUNDED_LINES the projection costs more than the evaluations it saves
+        constexpr int MIN_BOUNDED_LINES = 8;
+        if (centered_count > 0 && centered_count < MIN_BOUNDED_LINES)
+        {
+            for (int c = 0; c < centered_count; ++c)
+            {
+                int i = centered[c];
+                math::vector3 direction(orientations.cos_theta[i], 0.f, orientations.sin_theta[i]);
+                place(direction, first_cast, second_cast);
+                consider(i, direction, first_cast, second_cast);
+            }
+        }
+        else if (centered_count > 0)
+        {
+            // Polar bound: lines centered on the target are symmetric under theta + pi,
+            // so one projection of the reachable region and the PDF cells around the
+            // target bounds both probabilities of every centered table line at once
+            float half_length = vector_length * 0.5f;
+
+            // Widen the line by BOUND_SLACK world units and the masses by MASS_SLACK so
+            // float rounding (fast_atan2, span sums) never drops a bound below its exact value
+            constexpr float BOUND_SLACK = 0.5f;
+            constexpr float MASS_SLACK = 1e-4f;
+            constexpr float LIGHT_CELL_MASS = 1e-3f;
+
+            OrientationHistogram physics;
+            OrientationHistogram behavior;
+            float offset_x = reachable_region.center.x - predicted_target_pos.x;
+            float offset_z = reachable_region.center.z - predicted_target_pos.z;
+
+            // Physics: the closed-form fraction is bounded per line below; the spiral
+            // fraction histogram counts the same samples as the exact test
+            bool analytic = PredictionConfig::get().use_analytic_reachability;
+            if (!analytic)
+            {
+                const auto& spiral = TierParams<TIER>::SPIRAL;
+                alignas(32) float spiral_x[TierParams<TIER>::SPIRAL.SAMPLES];
+                alignas(32) float spiral_z[TierParams<TIER>::SPIRAL.SAMPLES];
+                alignas(32) float spiral_phi[TierParams<TIER>::SPIRAL.SAMPLES];
+                alignas(32) float spiral_arc[TierParams<TIER>::SPIRAL.SAMPLES];
+                for (int i = 0; i < spiral.SAMPLES; ++i)
+                {
+                    float r = reachable_region.max_radius * spiral.radius_scale[i];
+                    spiral_x[i] = offset_x + r * spiral.cos_theta[i];
+                    spiral_z[i] = offset_z + r * spiral.sin_theta[i];
+                }
+
+                SIMD::CenteredLineParams line = SIMD::CenteredLineParams::make(half_length, vector_width + BOUND_SLACK);
+                SIMD::centered_line_arcs(spiral_x, spiral_z, spiral.SAMPLES, line, spiral_phi, spiral_arc);
+                physics.add(spiral_phi, spiral_arc, 1.f / spiral.SAMPLES, spiral.SAMPLES);
+            }
+
+            // Behavior: strip_probability sums the cells whose centers lie inside the line
+            bool has_behavior = behavior_pdf.total_probability >= EPSILON;
+            if (has_behavior)
+            {
+                constexpr int HALF_GRID = BehaviorPDF::GRID_SIZE / 2;
+                constexpr int CELL_COUNT = BehaviorPDF::GRID_SIZE * BehaviorPDF::GRID_SIZE;
+                SIMD::CenteredLineParams line = SIMD::CenteredLineParams::make(half_length, vector_width + BOUND_SLACK);
+                alignas(32) float cell_x[CELL_COUNT];
+                alignas(32) float cell_z[CELL_COUNT];
+                alignas(32) float cell_mass[CELL_COUNT];
+                alignas(32) float cell_phi[CELL_COUNT];
+                alignas(32) float cell_arc[CELL_COUNT];
+                int cells = 0;
+
+                for (int x = behavior_pdf.active_x_first; x <= behavior_pdf.active_x_last; ++x)
+                {
+                    float dx = behavior_pdf.origin.x + (x - HALF_GRID + 0.5f) * behavior_pdf.cell_size - predicted_target_pos.x;
+                    for (int z = behavior_pdf.active_z_first; z <= behavior_pdf.active_z_last; ++z)
+                    {
+                        float mass = behavior_pdf.pdf_grid[x][z];
+                        if (mass <= 0.f)
+                            continue;
+
+                        // Cells within the width (or light ones) count for every orientation,
+                        // cells past the line ends for none: only the rest need an arc
+                        float dz = behavior_pdf.origin.z + (z - HALF_GRID + 0.5f) * behavior_pdf.cell_size - predicted_target_pos.z;
+                        float r_sq = dx * dx + dz * dz;
+                        if (r_sq > line.reach_sq)
+                            continue;
+                        if (r_sq <= line.half_width_sq || mass < LIGHT_CELL_MASS)
+                        {
+                            behavior.base += mass;
+                            continue;
+                        }
+
+                        cell_x[cells] = dx;
+                        cell_z[cells] = dz;
+                        cell_mass[cells] = mass;
+                        ++cells;
+                    }
+                }
+
+                if (cells > 0)
+                {
+                    SIMD::centered_line_arcs(cell_x, cell_z, cells, line, cell_phi, cell_arc);
+                    behavior.add(cell_phi, cell_arc, cell_mass, cells);
+                }
+            }
+
+            float physics_bound[OrientationHistogram::BINS];
+            float behavior_bound[OrientationHistogram::BINS];
+            physics.resolve(physics_bound);
+            behavior.resolve(behavior_bound);
+
+            struct Candidate
+            {
+                float bound;
+                int index;
+            };
+            Candidate candidates[TierParams<TIER>::ORIENTATIONS.SAMPLES];
+
+            // Both directions of a centered line share its bin and bound
+            float line_bound[OrientationHistogram::BINS];
+            std::fill(std::begin(line_bound), std::end(line_bound), -1.f);
+
+            for (int c = 0; c < centered_count; ++c)
+            {
+                int i = centered[c];
+
+                // Table angle 2*pi*i/SAMPLES is the center of bin (2 * BINS * i / SAMPLES) mod BINS
+                int bin = (2 * OrientationHistogram::BINS * i / orientations.SAMPLES) % OrientationHistogram::BINS;
+                if (line_bound[bin] < 0.f)
+                {
+                    float physics_prob = physics_bound[bin];
+                    if (analytic)
+                    {
+                        // Capsule inside both the width band and the length band (one cap past each end)
+                        float disk_radius = reachable_region.max_radius;
+                        float disk_area = PI * disk_radius * disk_radius;
+                        float along = std::abs(offset_x * orientations.cos_theta[i] + offset_z * orientations.sin_theta[i]);
+                        float perp = std::abs(offset_x * orientations.sin_theta[i] - offset_z * orientations.cos_theta[i]);
+                        physics_prob = disk_area > EPSILON ? std::min(disk_band_area(disk_radius, perp, vector_width),
+                            disk_band_area(disk_radius, along, half_length + vector_width)) / disk_area : 1.f;
+                    }
+                    physics_prob = std::min(physics_prob + MASS_SLACK, 1.f);
+                    float behavior_prob = has_behavior ? std::min(behavior_bound[bin] + MASS_SLACK, 1.f) : 1.f;
+                    line_bound[bin] = fuse_probabilities(physics_prob, behavior_prob, confidence, sample_count);
+                }
+                candidates[c] = { line_bound[bin], i };
+            }
+
+            // Fusion is monotone in both terms, so no line whose bound is below the best
+            // exact score can win: the result equals the table loop's
+            std::sort(candidates, candidates + centered_count, [](const Candidate& a, const Candidate& b) {
+                return a.bound > b.bound || (a.bound == b.bound && a.index < b.index);
+            });
+
+            for (int c = 0; c < centered_count; ++c)
+            {
+                if (candidates[c].bound < best_config.hit_chance)
+                    break;
+
+                int i = candidates[c].index;
+                math::vector3 direction(orientations.cos_theta[i], 0.f, orientations.sin_theta[i]);
+                place(direction, first_cast, second_cast);
+                consider(i, direction, first_cast, second_cast);
+            }
         }
 
         // If no valid configuration found, use default (aim at target)
@@ -2513,6 +4334,79 @@ namespace HybridPred
         return best_config;
     }
 
+    // =========================================================================
+    // FRAME RESULT CACHE
+    // =========================================================================
+
+    PredictionCacheKey PredictionCacheKey::make(game_object* source, game_object* target, const pred_sdk::spell_data& spell)
+    {
+        auto quantize = [](float value, float scale) -> int32_t
+        {
+            // Clamp before conversion (projectile_speed is FLT_MAX for instant spells)
+            constexpr float LIMIT = 1e9f;
+            return static_cast<int32_t>(std::lround(std::clamp(value * scale, -LIMIT, LIMIT)));
+        };
+
+        PredictionCacheKey key;
+        key.target_id = target->get_network_id();
+
+        math::vector3 source_pos = source->get_position();
+        key.source_id = source->get_network_id();
+        key.source_x = quantize(source_pos.x, 1.f);
+        key.source_z = quantize(source_pos.z, 1.f);
+
+        key.range = quantize(spell.range, 1.f);
+        key.radius = quantize(spell.radius, 1.f);
+        key.cast_range = quantize(spell.cast_range, 1.f);
+        key.delay_ms = quantize(spell.delay, 1000.f);
+        key.proc_delay_ms = quantize(spell.proc_delay, 1000.f);
+        key.projectile_speed = quantize(std::min(spell.projectile_speed, 1e8f), 1.f);
+        key.expected_hitchance = spell.expected_hitchance;
+        key.spell_slot = spell.spell_slot;
+
+        for (pred_sdk::collision_type collision : spell.forbidden_collisions)
+            key.collision_mask |= 1u << (static_cast<uint32_t>(collision) & 31u);
+
+        key.spell_type = static_cast<uint8_t>(spell.spell_type);
+        key.targetting_type = static_cast<uint8_t>(spell.targetting_type);
+        return key;
+    }
+
+    size_t PredictionCacheKeyHash::operator()(const PredictionCacheKey& key) const
+    {
+        // FNV-1a over the 32-bit fields
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](uint32_t value)
+        {
+            hash ^= value;
+            hash *= 1099511628211ull;
+        };
+
+        mix(key.target_id);
+        mix(key.source_id);
+        mix(static_cast<uint32_t>(key.source_x));
+        mix(static_cast<uint32_t>(key.source_z));
+        mix(static_cast<uint32_t>(key.range));
+        mix(static_cast<uint32_t>(key.radius));
+        mix(static_cast<uint32_t>(key.cast_range));
+        mix(static_cast<uint32_t>(key.delay_ms));
+        mix(static_cast<uint32_t>(key.proc_delay_ms));
+        mix(static_cast<uint32_t>(key.projectile_speed));
+        mix(static_cast<uint32_t>(key.expected_hitchance));
+        mix(static_cast<uint32_t>(key.spell_slot));
+        mix(key.collision_mask);
+        mix((static_cast<uint32_t>(key.spell_type) << 8) | key.targetting_type);
+
+        return static_cast<size_t>(hash);
+    }
+
+    void PredictionManager::invalidate_frame_cache(float current_time)
+    {
+        cache_stats_.evictions += frame_cache_.size();
+        frame_cache_.clear();
+        frame_cache_time_ = current_time;
+    }
+
     // =========================================================================
     // PREDICTION MANAGER IMPLEMENTATION
     // =========================================================================
@@ -2521,89 +4415,154 @@ namespace HybridPred
     {
         float current_time = g_sdk->clock_facade->get_game_time();
 
-        // Update all existing trackers
-        for (auto& pair : trackers_)
-        {
-            if (pair.second)
-            {
-                pair.second->update();
-            }
-        }
+        // New game_update: last frame's prediction temporaries are dead
+        FrameArena::reset();
 
-        // Clean up invalid trackers
-        for (auto it = trackers_.begin(); it != trackers_.end(); )
-        {
-            bool should_remove = false;
+        // Fresh per-frame prediction budget (every call starts at full quality again)
+        PredictionBudget::begin_frame();
 
-            if (!it->second)
-            {
-                // Null pointer - immediate removal
-                should_remove = true;
-            }
-            else
-            {
-                // Attempt to get target from object manager
-                game_object* target = g_sdk->object_manager->get_object_by_network_id(it->first);
+        // Trackers are about to change: results from the previous tick are stale
+        invalidate_frame_cache(current_time);
 
-                const auto& history = it->second->get_history();
+        // Newest background PDFs stay in place for this tick's predictions
+        PdfWorker::acquire_results();
 
-                if (!target)
-                {
-                    // Target no longer exists (died, recalled, DC'd)
-                    // Keep tracker for TRACKER_TIMEOUT in case they respawn/reconnect
-                    if (history.empty())
-                    {
-                        should_remove = true;  // Never collected data
-                    }
-                    else
-                    {
-                        float time_since_last = current_time - history.back().timestamp;
-                        if (time_since_last > TRACKER_TIMEOUT)
-                        {
-                            should_remove = true;
-                        }
-                    }
-                }
-                else
+        // Fresh edge case snapshot (windwalls once per frame, targets filled on first use)
+        EdgeCases::begin_frame(current_time);
+
+        // Relevance scheduling reference (nullptr: every tracker runs at full fidelity)
+        game_object* local_player = PredictionConfig::get().enable_tracker_lod
+            ? g_sdk->object_manager->get_local_player()
+            : nullptr;
+
+        // Single pass over the pool: drop expired trackers, sample the rest
+        for (size_t slot = 0; slot < trackers_.capacity(); ++slot)
+        {
+            if (!trackers_.is_occupied(slot))
+                continue;
+
+            TargetBehaviorTracker& tracker = trackers_.at(slot);
+            game_object* target = g_sdk->object_manager->get_object_by_network_id(trackers_.network_id(slot));
+
+            if (!target)
+            {
+                // Target no longer exists (died, recalled, DC'd)
+                // Keep tracker for TRACKER_TIMEOUT in case they respawn/reconnect
+                const auto& history = tracker.get_history();
+                if (history.empty() ||  // Never collected data
+                    current_time - history.timestamp(history.size() - 1) > TRACKER_TIMEOUT)
                 {
-                    // Target exists - keep tracker
-                    // Even if in fog of war, preserve learned patterns
-                    should_remove = false;
+                    if (harvest_profile(tracker))
+                        ProfileStore::flush();
+                    trackers_.release(slot);
                 }
+                continue;
             }
 
-            if (should_remove)
-            {
-                it = trackers_.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
+            // Target exists - sample through the pointer just validated
+            // Even if in fog of war, preserve learned patterns
+            tracker.set_target(target);
+            tracker.set_lod(select_lod(target, local_player, trackers_.last_used(slot), current_time));
+            tracker.update();
         }
 
+        // Snapshot visible enemies for the background worker (no-op unless enabled)
+        PdfWorker::submit(trackers_);
+
+        // Resolve landed casts, hand this tick's telemetry to the writer
+        Telemetry::Recorder::end_frame(current_time);
+
         last_update_time_ = current_time;
     }
 
+    bool PredictionManager::harvest_profile(const TargetBehaviorTracker& tracker)
+    {
+        ProfileObservation observation;
+        if (!ProfileStore::is_open() || tracker.get_profile_hash() == 0 || !tracker.observe_profile(observation))
+            return false;
+
+        ProfileStore::merge(tracker.get_profile_hash(), observation);
+        return true;
+    }
+
+    void PredictionManager::harvest_profiles()
+    {
+        if (!ProfileStore::is_open())
+            return;
+
+        for (size_t slot = 0; slot < trackers_.capacity(); ++slot)
+        {
+            if (trackers_.is_occupied(slot))
+                harvest_profile(trackers_.at(slot));
+        }
+
+        ProfileStore::flush();
+    }
+
     TargetBehaviorTracker* PredictionManager::get_tracker(game_object* target)
+    {
+        return trackers_.resolve(acquire_tracker(target));
+    }
+
+    TrackerHandle PredictionManager::acquire_tracker(game_object* target)
     {
         if (!target || !target->is_valid())
-            return nullptr;
+            return TrackerHandle{};
 
-        uint32_t network_id = target->get_network_id();
+        // Champions keep their slot; minions/monsters/pets are recycled when the pool fills
+        float current_time = g_sdk->clock_facade->get_game_time();
+        bool created = false;
+        TrackerHandle handle = trackers_.acquire(target, !target->is_hero(), current_time, &created);
 
-        auto it = trackers_.find(network_id);
-        if (it != trackers_.end())
+        // Predicted targets get full fidelity right away (publishes any deferred analysis)
+        if (auto* tracker = trackers_.resolve(handle))
         {
-            return it->second.get();
+            tracker->set_lod(TrackerLod::full);
+
+            // Fresh enemy champion tracker: warm start from the stored profile
+            // (allies and the local player are never profiled)
+            game_object* local_player = g_sdk->object_manager->get_local_player();
+            if (created && target->is_hero() && ProfileStore::is_open() &&
+                local_player && target->get_team_id() != local_player->get_team_id())
+            {
+                uint32_t hash = ProfileStore::champion_hash(target->get_char_name());
+                tracker->apply_profile(hash, ProfileStore::find(hash));
+            }
         }
 
-        // Create new tracker
-        auto tracker = std::make_unique<TargetBehaviorTracker>(target);
-        auto* tracker_ptr = tracker.get();
-        trackers_[network_id] = std::move(tracker);
+        return handle;
+    }
+
+    TrackerLod PredictionManager::select_lod(game_object* target, game_object* local_player,
+        float last_requested, float current_time)
+    {
+        if (!local_player || current_time - last_requested < LOD_RECENT_PREDICT_TIME)
+            return TrackerLod::full;
+
+        // Fog of war: the reported position is frozen, fresh samples add nothing
+        if (!target->is_visible())
+            return TrackerLod::minimal;
+
+        float distance = target->get_position().distance(local_player->get_position());
+        if (distance <= LOD_NEAR_DISTANCE)
+            return TrackerLod::full;
+        if (distance <= LOD_FAR_DISTANCE)
+            return TrackerLod::reduced;
+        return TrackerLod::minimal;
+    }
+
+    TargetBehaviorTracker* PredictionManager::prepare_target(
+        game_object* source,
+        game_object* target,
+        EdgeCases::EdgeCaseAnalysis& edge_cases)
+    {
+        auto* tracker = get_tracker(target);
+        if (!tracker)
+            return nullptr;
 
-        return tracker_ptr;
+        HYBRID_PROFILE_SCOPE(edge_cases);
+        edge_cases = EdgeCases::analyze_target(target, source);
+        return tracker;
     }
 
     HybridPredictionResult PredictionManager::predict(
@@ -2611,7 +4570,8 @@ namespace HybridPred
         game_object* target,
         const pred_sdk::spell_data& spell)
     {
-        auto* tracker = get_tracker(target);
+        EdgeCases::EdgeCaseAnalysis edge_cases;
+        auto* tracker = prepare_target(source, target, edge_cases);
         if (!tracker)
         {
             HybridPredictionResult result;
@@ -2619,12 +4579,511 @@ namespace HybridPred
             return result;
         }
 
-        return HybridFusionEngine::compute_hybrid_prediction(source, target, spell, *tracker);
+        return predict_cached(source, target, spell, *tracker, edge_cases);
+    }
+
+    std::vector<BatchPrediction> PredictionManager::predict_batch(
+        game_object* source,
+        const std::vector<game_object*>& targets,
+        const std::vector<pred_sdk::spell_data>& spells)
+    {
+        std::vector<BatchPrediction> batch;
+        batch.reserve(targets.size());
+
+        for (game_object* target : targets)
+        {
+            BatchPrediction entry;
+            auto* tracker = prepare_target(source, target, entry.edge_cases);
+            if (!tracker)
+                continue;
+
+            entry.target = target;
+            entry.results.reserve(spells.size());
+
+            // Shared target state computed once, shape-specific scoring per spell
+            for (const pred_sdk::spell_data& spell : spells)
+                entry.results.push_back(predict_cached(source, target, spell, *tracker, entry.edge_cases));
+
+            batch.push_back(std::move(entry));
+        }
+
+        return batch;
+    }
+
+    AoePredictionResult PredictionManager::predict_aoe(
+        game_object* source,
+        const std::vector<game_object*>& targets,
+        const pred_sdk::spell_data& spell,
+        int min_hits)
+    {
+        std::vector<AoeTargetInput> inputs;
+        std::vector<TrackerHandle> handles;
+        inputs.reserve(targets.size());
+        handles.reserve(targets.size());
+
+        // Acquire every tracker before resolving any: a later acquire may recycle
+        // an earlier target's (non-champion) slot
+        for (size_t i = 0; i < targets.size(); ++i)
+        {
+            game_object* target = targets[i];
+            if (std::find(targets.begin(), targets.begin() + i, target) != targets.begin() + i)
+                continue;
+
+            TrackerHandle handle = acquire_tracker(target);
+            if (!handle.is_valid())
+                continue;
+
+            AoeTargetInput input;
+            input.target = target;
+            {
+                HYBRID_PROFILE_SCOPE(edge_cases);
+                input.edge_cases = EdgeCases::analyze_target(target, source);
+            }
+            inputs.push_back(std::move(input));
+            handles.push_back(handle);
+        }
+
+        // Recycled handles resolve to nullptr: those targets drop out of this call
+        size_t kept = 0;
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            TargetBehaviorTracker* tracker = trackers_.resolve(handles[i]);
+            if (!tracker)
+                continue;
+
+            if (kept != i)
+                inputs[kept] = std::move(inputs[i]);
+            inputs[kept++].tracker = tracker;
+        }
+        inputs.resize(kept);
+
+        return HybridFusionEngine::compute_aoe_prediction(source, inputs, spell, min_hits);
+    }
+
+    HybridPredictionResult PredictionManager::predict_cached(
+        game_object* source,
+        game_object* target,
+        const pred_sdk::spell_data& spell,
+        TargetBehaviorTracker& tracker,
+        const EdgeCases::EdgeCaseAnalysis& edge_cases)
+    {
+        auto compute = [&]()
+        {
+            HybridPredictionResult computed =
+                HybridFusionEngine::compute_hybrid_prediction(source, target, spell, tracker, edge_cases);
+
+            if (Trace::Recorder::is_active())
+            {
+                Trace::Recorder::record_request(source, target, spell,
+                    computed.is_valid, computed.hit_chance, computed.cast_position);
+            }
+            if (Telemetry::Recorder::is_active())
+                Telemetry::Recorder::record_prediction(source, target, spell, computed, tracker.get_dodge_pattern());
+            return computed;
+        };
+
+        if (!PredictionConfig::get().enable_frame_result_cache || !source || !source->is_valid() ||
+            !g_sdk || !g_sdk->clock_facade)
+        {
+            return compute();
+        }
+
+        // Game clock advanced since the last cached result: flush
+        float current_time = g_sdk->clock_facade->get_game_time();
+        if (current_time != frame_cache_time_)
+            invalidate_frame_cache(current_time);
+
+        PredictionCacheKey key = PredictionCacheKey::make(source, target, spell);
+        size_t hash = PredictionCacheKeyHash{}(key);
+        for (const FrameCacheEntry& entry : frame_cache_)
+        {
+            if (entry.hash == hash && entry.key == key)
+            {
+                ++cache_stats_.hits;
+                return entry.result;
+            }
+        }
+
+        ++cache_stats_.misses;
+        HybridPredictionResult result = compute();
+        frame_cache_.push_back(FrameCacheEntry{ hash, key, result });
+        return result;
+    }
+
+    CacheStats PredictionManager::get_pdf_cache_stats()
+    {
+        CacheStats total;
+        for (size_t slot = 0; slot < trackers_.capacity(); ++slot)
+        {
+            if (trackers_.is_occupied(slot))
+                total += trackers_.at(slot).get_pdf_cache_stats();
+        }
+        return total;
     }
 
     void PredictionManager::clear()
     {
+        PdfWorker::shutdown();
+        harvest_profiles();
         trackers_.clear();
+        frame_cache_.clear();
+        frame_cache_time_ = -1.f;
+        EdgeCases::clear_frame_snapshot();
+        Trace::Recorder::close();
+        Telemetry::Recorder::shutdown();
+        FrameArena::release();
+    }
+
+    // =========================================================================
+    // TRACE RECORDING
+    // =========================================================================
+
+    void Trace::Recorder::record_snapshot(uint32_t network_id, const MovementSnapshot& snapshot,
+        float move_speed, float bounding_radius)
+    {
+        SnapshotRecord record{};
+        record.network_id = network_id;
+        record.timestamp = snapshot.timestamp;
+        record.position[0] = snapshot.position.x;
+        record.position[1] = snapshot.position.y;
+        record.position[2] = snapshot.position.z;
+        record.hp_percent = snapshot.hp_percent;
+        record.move_speed = move_speed;
+        record.bounding_radius = bounding_radius;
+        record.flags =
+            (snapshot.is_auto_attacking ? SnapshotRecord::AUTO_ATTACKING : 0) |
+            (snapshot.is_casting ? SnapshotRecord::CASTING : 0) |
+            (snapshot.is_dashing ? SnapshotRecord::DASHING : 0) |
+            (snapshot.is_cced ? SnapshotRecord::CCED : 0);
+
+        write(RecordType::snapshot, record);
     }
 
-} // namespace HybridPred
\ No newline at end of file
+    void Trace::Recorder::record_request(game_object* source, game_object* target,
+        const pred_sdk::spell_data& spell, bool is_valid, float hit_chance,
+        const math::vector3& cast_position)
+    {
+        if (!source || !target)
+            return;
+
+        RequestRecord record{};
+        record.time = g_sdk->clock_facade->get_game_time();
+        record.source_id = source->get_network_id();
+        record.target_id = target->get_network_id();
+
+        math::vector3 source_pos = source->get_position();
+        record.source_position[0] = source_pos.x;
+        record.source_position[1] = source_pos.y;
+        record.source_position[2] = source_pos.z;
+
+        record.range = spell.range;
+        record.radius = spell.radius;
+        record.delay = spell.delay;
+        record.projectile_speed = spell.projectile_speed;
+        record.ping_ms = static_cast<int16_t>(g_sdk->net_client ? g_sdk->net_client->get_ping() : 0);
+        record.spell_type = static_cast<uint8_t>(spell.spell_type);
+        record.is_valid = is_valid ? 1 : 0;
+        record.hit_chance = hit_chance;
+        record.cast_position[0] = cast_position.x;
+        record.cast_position[1] = cast_position.y;
+        record.cast_position[2] = cast_position.z;
+
+        write(RecordType::request, record);
+    }
+
+    // =========================================================================
+    // OUTCOME TELEMETRY
+    // =========================================================================
+
+    void Telemetry::Recorder::start(const char* path)
+    {
+        State& telemetry = state();
+        if (!path || !path[0])
+        {
+            telemetry.open_failed = true;
+            return;
+        }
+
+        // One file per session: "<stem>_<unix time><extension>" (never truncate earlier games)
+        const char* name = path;
+        for (const char* c = path; *c; ++c)
+        {
+            if (*c == '/' || *c == '\\')
+                name = c + 1;
+        }
+
+        const char* extension = std::strrchr(name, '.');
+        if (!extension)
+            extension = name + std::strlen(name);
+
+        std::snprintf(telemetry.session_path, sizeof(telemetry.session_path), "%.*s_%lld%s",
+            static_cast<int>(extension - path), path, static_cast<long long>(std::time(nullptr)), extension);
+
+        telemetry.file = std::fopen(telemetry.session_path, "wb");
+        if (!telemetry.file)
+        {
+            telemetry.session_path[0] = '\0';
+            telemetry.open_failed = true;
+            return;
+        }
+
+        std::setvbuf(telemetry.file, nullptr, _IOFBF, 1 << 16);
+        FileHeader header;
+        std::fwrite(&header, sizeof(header), 1, telemetry.file);
+
+        telemetry.running.store(true, std::memory_order_release);
+        telemetry.thread = std::thread(run);
+    }
+
+    void Telemetry::Recorder::run()
+    {
+        State& telemetry = state();
+        std::vector<PredictionRecord> predictions;
+        std::vector<CastRecord> casts;
+        std::vector<OutcomeRecord> outcomes;
+        std::vector<uint8_t> scratch;
+        predictions.reserve(BLOCK_ROWS);
+
+        uint32_t seen = 0;
+        bool running = true;
+        while (running)
+        {
+            telemetry.frames.wait(seen, std::memory_order_acquire);
+            seen = telemetry.frames.load(std::memory_order_acquire);
+            running = telemetry.running.load(std::memory_order_acquire);
+
+            // Everything published before this wake-up (and before shutdown) is drained
+            Record record;
+            while (telemetry.ring.pop(record))
+            {
+                switch (record.type)
+                {
+                case RecordType::prediction:
+                    predictions.push_back(record.prediction);
+                    if (predictions.size() >= BLOCK_ROWS)
+                        write_block(telemetry.file, RecordType::prediction, predictions, PREDICTION_COLUMNS, scratch);
+                    break;
+                case RecordType::cast:
+                    casts.push_back(record.cast);
+                    if (casts.size() >= BLOCK_ROWS)
+                        write_block(telemetry.file, RecordType::cast, casts, CAST_COLUMNS, scratch);
+                    break;
+                case RecordType::outcome:
+                    outcomes.push_back(record.outcome);
+                    if (outcomes.size() >= BLOCK_ROWS)
+                        write_block(telemetry.file, RecordType::outcome, outcomes, OUTCOME_COLUMNS, scratch);
+                    break;
+                }
+            }
+        }
+
+        write_block(telemetry.file, RecordType::prediction, predictions, PREDICTION_COLUMNS, scratch);
+        write_block(telemetry.file, RecordType::cast, casts, CAST_COLUMNS, scratch);
+        write_block(telemetry.file, RecordType::outcome, outcomes, OUTCOME_COLUMNS, scratch);
+        std::fclose(telemetry.file);
+        telemetry.file = nullptr;
+    }
+
+    void Telemetry::Recorder::push(const Record& record)
+    {
+        State& telemetry = state();
+        if (!telemetry.ring.push(record))
+        {
+            ++telemetry.stats.dropped;
+            return;
+        }
+
+        switch (record.type)
+        {
+        case RecordType::prediction: ++telemetry.stats.predictions; break;
+        case RecordType::cast: ++telemetry.stats.casts; break;
+        case RecordType::outcome: ++telemetry.stats.outcomes; break;
+        }
+    }
+
+    void Telemetry::Recorder::record_prediction(game_object* source, game_object* target,
+        const pred_sdk::spell_data& spell, const HybridPredictionResult& result, const DodgePattern& pattern)
+    {
+        if (!source || !target)
+            return;
+
+        State& telemetry = state();
+        float current_time = g_sdk->clock_facade->get_game_time();
+
+        Record record;
+        record.type = RecordType::prediction;
+        PredictionRecord& prediction = record.prediction;
+        prediction.id = telemetry.next_id++;
+        prediction.time = current_time;
+        prediction.source_id = source->get_network_id();
+        prediction.target_id = target->get_network_id();
+        prediction.spell_type = static_cast<uint8_t>(spell.spell_type);
+        prediction.spell_slot = static_cast<int8_t>(std::clamp(spell.spell_slot, -1, 127));
+        prediction.expected_hitchance = static_cast<int8_t>(std::clamp(spell.expected_hitchance, -1, 127));
+        prediction.flags =
+            (result.is_valid ? PredictionRecord::VALID : 0) |
+            (result.is_peak_opportunity ? PredictionRecord::PEAK_OPPORTUNITY : 0) |
+            (pattern.has_pattern ? PredictionRecord::HAS_PATTERN : 0);
+        prediction.hit_chance = result.hit_chance;
+        prediction.physics_contribution = result.physics_contribution;
+        prediction.behavior_contribution = result.behavior_contribution;
+        prediction.confidence_score = result.confidence_score;
+        prediction.opportunity_score = result.opportunity_score;
+        prediction.pattern_confidence = pattern.pattern_confidence;
+        prediction.cast_position[0] = result.cast_position.x;
+        prediction.cast_position[1] = result.cast_position.z;
+        push(record);
+
+        // Remember per slot so a following cast can be matched to it
+        if (spell.spell_slot < -1 || spell.spell_slot >= SLOT_COUNT - 1 || !result.is_valid)
+            return;
+
+        LastPrediction& last = telemetry.last_predictions[spell.spell_slot + 1];
+        last.valid = true;
+        last.id = prediction.id;
+        last.time = current_time;
+        last.source_id = prediction.source_id;
+        last.target_id = prediction.target_id;
+        last.spell_type = prediction.spell_type;
+        last.radius = spell.radius;
+        last.delay = spell.delay;
+        last.projectile_speed = spell.projectile_speed;
+        last.source_position = source->get_position();
+        last.line_start = spell.spell_type == pred_sdk::spell_type::vector ? result.first_cast_position : last.source_position;
+        last.cast_position = result.cast_position;
+    }
+
+    void Telemetry::Recorder::on_process_cast(game_object* object, spell_cast* cast)
+    {
+        if (!object || !cast || cast->is_basic_attack() || !is_active())
+            return;
+
+        int slot = cast->get_spell_slot();
+        if (slot < -1 || slot >= SLOT_COUNT - 1)
+            return;
+
+        State& telemetry = state();
+        LastPrediction& last = telemetry.last_predictions[slot + 1];
+        float current_time = g_sdk->clock_facade->get_game_time();
+        if (!last.valid || last.source_id != object->get_network_id() || current_time - last.time > CAST_MATCH_WINDOW)
+            return;
+        last.valid = false;
+
+        math::vector3 cast_position = cast->get_cast_pos();
+
+        Record record;
+        record.type = RecordType::cast;
+        record.cast.prediction_id = last.id;
+        record.cast.time = current_time;
+        record.cast.cast_position[0] = cast_position.x;
+        record.cast.cast_position[1] = cast_position.z;
+        push(record);
+
+        if (telemetry.pending_count >= MAX_PENDING)
+            return;
+
+        // Judge against where the spell actually went
+        PendingOutcome& pending = telemetry.pending[telemetry.pending_count++];
+        pending.prediction = last;
+        pending.prediction.cast_position = cast_position;
+        pending.due_time = current_time + PhysicsPredictor::compute_arrival_time(
+            last.source_position, cast_position, last.projectile_speed, last.delay);
+    }
+
+    void Telemetry::Recorder::end_frame(float current_time)
+    {
+        State& telemetry = state();
+        if (!telemetry.thread.joinable())
+            return;
+
+        for (size_t i = 0; i < telemetry.pending_count;)
+        {
+            const PendingOutcome& pending = telemetry.pending[i];
+            if (pending.due_time > current_time)
+            {
+                ++i;
+                continue;
+            }
+
+            const LastPrediction& prediction = pending.prediction;
+            Record record;
+            record.type = RecordType::outcome;
+            record.outcome.prediction_id = prediction.id;
+            record.outcome.time = pending.due_time;
+            record.outcome.result = OutcomeRecord::UNKNOWN;
+            record.outcome.miss_distance = 0.f;
+
+            game_object* target = g_sdk->object_manager->get_object_by_network_id(prediction.target_id);
+            if (target && target->is_valid() && !target->is_dead())
+            {
+                // Circle at the cast position, line from source (vector: first cast) to cast position
+                math::vector3 landed = target->get_position();
+                auto type = static_cast<pred_sdk::spell_type>(prediction.spell_type);
+                float distance = 0.f;
+                if (type == pred_sdk::spell_type::linear || type == pred_sdk::spell_type::vector)
+                {
+                    math::vector3 segment = prediction.cast_position - prediction.line_start;
+                    float length_sq = segment.x * segment.x + segment.z * segment.z;
+                    float t = length_sq > EPSILON ? std::clamp(((landed.x - prediction.line_start.x) * segment.x +
+                        (landed.z - prediction.line_start.z) * segment.z) / length_sq, 0.f, 1.f) : 0.f;
+                    distance = landed.distance(prediction.line_start + segment * t);
+                }
+                else if (type != pred_sdk::spell_type::targetted)
+                {
+                    distance = landed.distance(prediction.cast_position);
+                }
+
+                record.outcome.miss_distance = distance - (prediction.radius + target->get_bounding_radius());
+                record.outcome.result = record.outcome.miss_distance <= 0.f ? OutcomeRecord::HIT : OutcomeRecord::MISS;
+            }
+            push(record);
+
+            telemetry.pending[i] = telemetry.pending[--telemetry.pending_count];
+        }
+
+        telemetry.frames.fetch_add(1, std::memory_order_release);
+        telemetry.frames.notify_one();
+    }
+
+} // namespace HybridPred
+
+// =============================================================================
+// HEAP ALLOCATION COUNTER (HYBRID_PRED_COUNT_ALLOCATIONS builds only)
+// =============================================================================
+
+#if HYBRID_PRED_COUNT_ALLOCATIONS
+
+void* operator new(size_t size)
+{
+    ++HybridPred::FrameArena::heap_allocation_count;
+    if (void* pointer = std::malloc(size ? size : 1))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+#endif // HYBRID_PRED_COUNT_ALLOCATIONS
@@ -10,15 +10,16 @@
 #include "sdk.hpp"
 #include "StandalonePredictionSDK.h"  // MUST be included AFTER sdk.hpp for compatibility
 #include "EdgeCaseDetection.h"
+#include "FrameArena.h"
 #include <vector>
 #include <deque>
 #include <cmath>
 #include <algorithm>
 #include <unordered_map>
 #include <memory>
-
-// Enable telemetry: Set to 1 to track pattern detection stats (prints on game end)
-#define ENABLE_PATTERN_TELEMETRY 0
+#include <array>
+#include <optional>
+#include <span>
 
 /**
  * =============================================================================
@@ -68,8 +69,49 @@ namespace HybridPred
     constexpr float BEHAVIOR_DECAY_RATE = 0.95f;    // Exponential decay factor
     constexpr int MIN_SAMPLES_FOR_BEHAVIOR = 10;    // Minimum data for behavior model
 
+    // Champion profile priors (ProfileStore.h)
+    constexpr float PROFILE_PRIOR_SAMPLES = 10.f;   // Pseudo-samples a fully learned profile is worth
+    constexpr int PROFILE_FULL_OBSERVATIONS = 8;    // Stored observations for full prior weight
+    constexpr float PROFILE_CONFIDENCE_FLOOR = 0.5f; // Sample-size confidence floor while seeded
+
     // Tracker cleanup parameters
     constexpr float TRACKER_TIMEOUT = 30.0f;        // Remove trackers after 30s when target doesn't exist
+    constexpr size_t MAX_TRACKERS = 32;             // Tracker pool capacity (non-champion slots are LRU-recycled)
+
+    // Tracker level of detail (relevance scheduling in PredictionManager::update)
+    constexpr float LOD_NEAR_DISTANCE = 2500.f;     // Full fidelity within this range of the local player
+    constexpr float LOD_FAR_DISTANCE = 6000.f;      // Reduced tier up to here, minimal beyond
+    constexpr float LOD_RECENT_PREDICT_TIME = 2.0f; // Targets passed to predict() stay at full fidelity this long
+
+    enum class TrackerLod : uint8_t
+    {
+        full = 0,                                   // Fighting range / recently predicted
+        reduced,                                    // Visible, mid range
+        minimal                                     // Far away or in fog of war
+    };
+
+    struct TrackerLodParams
+    {
+        float sample_interval;                      // Seconds between movement samples
+        int analysis_stride;                        // Pattern publish every N samples
+    };
+
+    inline constexpr TrackerLodParams TRACKER_LOD_PARAMS[] = {
+        { MOVEMENT_SAMPLE_RATE, 1 },
+        { MOVEMENT_SAMPLE_RATE * 2.f, 2 },
+        { MOVEMENT_SAMPLE_RATE * 5.f, 4 }
+    };
+
+    // Prediction pipeline quality tier (per-frame budget scheduling, see PredictionBudget.h)
+    // Each shape pipeline is instantiated once per tier with its own compile-time sample counts
+    enum class QualityTier : uint8_t
+    {
+        full = 0,                                   // 16x16 cast grid, 128 reachability samples, 32 boundary rays
+        reduced,                                    // 10x10 grid, 64 samples, 24 rays
+        minimal                                     // 6x6 grid, 32 samples, 16 rays
+    };
+
+    constexpr int QUALITY_TIER_COUNT = 3;
 
     // Physics parameters
     constexpr float DEFAULT_TURN_RATE = 2.0f * PI;  // radians/second
@@ -163,6 +205,264 @@ namespace HybridPred
             is_cced(false), hp_percent(100.f) {}
     };
 
+    // =========================================================================
+    // FIXED-CAPACITY HISTORY STORAGE
+    // =========================================================================
+
+    /**
+     * Fixed-capacity ring of trivially copyable values (no heap allocation)
+     * Index 0 = oldest; push_back overwrites the oldest entry once full
+     */
+    template<typename T, size_t N>
+    class FixedRing
+    {
+    public:
+        static constexpr size_t CAPACITY = N;
+
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        bool full() const { return size_ == N; }
+        void clear() { head_ = 0; size_ = 0; }
+
+        void push_back(const T& value)
+        {
+            if (size_ < N)
+            {
+                data_[(head_ + size_) % N] = value;
+                ++size_;
+            }
+            else
+            {
+                data_[head_] = value;
+                head_ = (head_ + 1) % N;
+            }
+        }
+
+        // Drop oldest entry (no-op when empty)
+        void pop_front()
+        {
+            if (size_ == 0)
+                return;
+            head_ = (head_ + 1) % N;
+            --size_;
+        }
+
+        // Drop newest entry (no-op when empty)
+        void pop_back()
+        {
+            if (size_ > 0)
+                --size_;
+        }
+
+        const T& operator[](size_t i) const { return data_[(head_ + i) % N]; }
+        const T& front() const { return data_[head_]; }
+        const T& back() const { return data_[(head_ + size_ - 1) % N]; }
+
+    private:
+        std::array<T, N> data_{};
+        size_t head_ = 0;
+        size_t size_ = 0;
+    };
+
+    /**
+     * Struct-of-arrays movement history ring (fixed capacity, no heap allocation)
+     *
+     * Every column is written twice (slot k and k + CAPACITY), so the live
+     * window is always one contiguous span starting at the oldest sample:
+     *   const float* vx = history.velocity_x();  // vx[0] oldest ... vx[size() - 1] newest
+     * Analysis scans stream over the columns they need instead of whole snapshots.
+     */
+    class MovementHistory
+    {
+    public:
+        static constexpr size_t CAPACITY = MOVEMENT_HISTORY_SIZE;
+
+        // Packed MovementSnapshot state bits
+        enum StateFlags : uint8_t
+        {
+            FLAG_AUTO_ATTACKING = 1 << 0,
+            FLAG_CASTING = 1 << 1,
+            FLAG_DASHING = 1 << 2,
+            FLAG_CCED = 1 << 3
+        };
+
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        void clear() { head_ = 0; size_ = 0; }
+
+        void push_back(const MovementSnapshot& snapshot)
+        {
+            size_t slot;
+            if (size_ < CAPACITY)
+            {
+                slot = (head_ + size_) % CAPACITY;
+                ++size_;
+            }
+            else
+            {
+                // Full: overwrite oldest
+                slot = head_;
+                head_ = (head_ + 1) % CAPACITY;
+            }
+
+            uint8_t packed = 0;
+            if (snapshot.is_auto_attacking) packed |= FLAG_AUTO_ATTACKING;
+            if (snapshot.is_casting) packed |= FLAG_CASTING;
+            if (snapshot.is_dashing) packed |= FLAG_DASHING;
+            if (snapshot.is_cced) packed |= FLAG_CCED;
+
+            for (size_t k : { slot, slot + CAPACITY })
+            {
+                pos_x_[k] = snapshot.position.x;
+                pos_y_[k] = snapshot.position.y;
+                pos_z_[k] = snapshot.position.z;
+                vel_x_[k] = snapshot.velocity.x;
+                vel_y_[k] = snapshot.velocity.y;
+                vel_z_[k] = snapshot.velocity.z;
+                timestamp_[k] = snapshot.timestamp;
+                hp_percent_[k] = snapshot.hp_percent;
+                flags_[k] = packed;
+            }
+        }
+
+        // Per-sample accessors (i = 0 oldest)
+        math::vector3 position(size_t i) const { size_t k = head_ + i; return math::vector3(pos_x_[k], pos_y_[k], pos_z_[k]); }
+        math::vector3 velocity(size_t i) const { size_t k = head_ + i; return math::vector3(vel_x_[k], vel_y_[k], vel_z_[k]); }
+        float timestamp(size_t i) const { return timestamp_[head_ + i]; }
+        uint8_t flags(size_t i) const { return flags_[head_ + i]; }
+        bool has_flag(size_t i, StateFlags flag) const { return (flags_[head_ + i] & flag) != 0; }
+
+        // Full snapshot reconstruction (cold paths)
+        MovementSnapshot operator[](size_t i) const
+        {
+            size_t k = head_ + i;
+            MovementSnapshot snapshot;
+            snapshot.position = math::vector3(pos_x_[k], pos_y_[k], pos_z_[k]);
+            snapshot.velocity = math::vector3(vel_x_[k], vel_y_[k], vel_z_[k]);
+            snapshot.timestamp = timestamp_[k];
+            snapshot.hp_percent = hp_percent_[k];
+            snapshot.is_auto_attacking = (flags_[k] & FLAG_AUTO_ATTACKING) != 0;
+            snapshot.is_casting = (flags_[k] & FLAG_CASTING) != 0;
+            snapshot.is_dashing = (flags_[k] & FLAG_DASHING) != 0;
+            snapshot.is_cced = (flags_[k] & FLAG_CCED) != 0;
+            return snapshot;
+        }
+
+        MovementSnapshot back() const { return (*this)[size_ - 1]; }
+
+        // Contiguous column spans (size() elements, oldest first)
+        const float* position_x() const { return pos_x_ + head_; }
+        const float* position_z() const { return pos_z_ + head_; }
+        const float* velocity_x() const { return vel_x_ + head_; }
+        const float* velocity_z() const { return vel_z_ + head_; }
+        const float* timestamps() const { return timestamp_ + head_; }
+        const uint8_t* state_flags() const { return flags_ + head_; }
+
+    private:
+        alignas(32) float pos_x_[2 * CAPACITY] = {};
+        alignas(32) float pos_y_[2 * CAPACITY] = {};
+        alignas(32) float pos_z_[2 * CAPACITY] = {};
+        alignas(32) float vel_x_[2 * CAPACITY] = {};
+        alignas(32) float vel_y_[2 * CAPACITY] = {};
+        alignas(32) float vel_z_[2 * CAPACITY] = {};
+        alignas(32) float timestamp_[2 * CAPACITY] = {};
+        alignas(32) float hp_percent_[2 * CAPACITY] = {};
+        uint8_t flags_[2 * CAPACITY] = {};
+        size_t head_ = 0;
+        size_t size_ = 0;
+    };
+
+    /**
+     * Waypoint path with cumulative segment lengths (per tracker)
+     *
+     * update() rebuilds only when the path changes (waypoint count, first or
+     * last waypoint differ), so repeated queries against one move order cost a
+     * binary search instead of a walk from the first segment. Distances are
+     * stored rather than arrival times: move speed changes (slows, boots) do
+     * not invalidate the cache, callers convert with distance = speed * time.
+     */
+    class PathCache
+    {
+    public:
+        void update(std::span<const math::vector3> path)
+        {
+            if (path.size() == points_.size() && !path.empty() &&
+                same_point(path.front(), points_.front()) && same_point(path.back(), points_.back()))
+                return;
+
+            points_.assign(path.begin(), path.end());
+            cumulative_.resize(points_.size());
+            float length = 0.f;
+            for (size_t i = 0; i < points_.size(); ++i)
+            {
+                if (i > 0)
+                    length += planar_distance(points_[i - 1], points_[i]);
+                cumulative_[i] = length;
+            }
+            ++rebuilds_;
+        }
+
+        size_t size() const { return points_.size(); }
+        bool empty() const { return points_.empty(); }
+        const math::vector3& end() const { return points_.back(); }
+        uint32_t rebuild_count() const { return rebuilds_; }
+
+        /**
+         * Position after travelling distance along the path from position, which
+         * lies on the segment ending at waypoint next_waypoint
+         * (game_object::get_current_path_index); clamps at the last waypoint
+         */
+        math::vector3 position_at(const math::vector3& position, size_t next_waypoint, float distance) const
+        {
+            if (points_.size() < 2)
+                return points_.empty() ? position : points_.back();
+
+            next_waypoint = std::clamp<size_t>(next_waypoint, 1, points_.size() - 1);
+
+            // Path coordinate of position: the next waypoint minus what is left of its segment
+            float to_next = planar_distance(position, points_[next_waypoint]);
+            float target = cumulative_[next_waypoint] - to_next + std::max(distance, 0.f);
+
+            // Still on the current segment
+            if (target <= cumulative_[next_waypoint])
+            {
+                if (to_next < 1e-3f)
+                    return points_[next_waypoint];
+                float t = std::max(distance, 0.f) / to_next;
+                return position + (points_[next_waypoint] - position) * t;
+            }
+
+            if (target >= cumulative_.back())
+                return points_.back();
+
+            // First waypoint at or past target (cumulative_ is non-decreasing)
+            size_t segment_end = std::upper_bound(cumulative_.begin() + next_waypoint + 1, cumulative_.end(), target)
+                - cumulative_.begin();
+            const math::vector3& from = points_[segment_end - 1];
+            const math::vector3& to = points_[segment_end];
+            float span = cumulative_[segment_end] - cumulative_[segment_end - 1];
+            float t = span > 1e-3f ? (target - cumulative_[segment_end - 1]) / span : 1.f;
+            return from + (to - from) * t;
+        }
+
+    private:
+        static float planar_distance(const math::vector3& a, const math::vector3& b)
+        {
+            float dx = b.x - a.x;
+            float dz = b.z - a.z;
+            return std::sqrt(dx * dx + dz * dz);
+        }
+
+        static bool same_point(const math::vector3& a, const math::vector3& b)
+        {
+            return a.x == b.x && a.y == b.y && a.z == b.z;
+        }
+
+        std::vector<math::vector3> points_;      // Capacity reused across move orders
+        std::vector<float> cumulative_;          // Path length up to each waypoint
+        uint32_t rebuilds_ = 0;
+    };
+
     /**
      * Dodge pattern statistics
      */
@@ -178,7 +478,8 @@ namespace HybridPred
         float reaction_delay;            // Average reaction time (ms)
 
         // Pattern repetition detection (NEW)
-        std::vector<int> juke_sequence;          // Last 8 direction changes: -1=left, 0=straight, 1=right
+        static constexpr size_t JUKE_SEQUENCE_LENGTH = 8;
+        FixedRing<int, JUKE_SEQUENCE_LENGTH> juke_sequence;  // Last 8 direction changes: -1=left, 0=straight, 1=right
         float pattern_confidence;                // [0,1] Confidence in detected pattern
         math::vector3 predicted_next_direction;  // Unit vector of predicted next move
         bool has_pattern;                        // True if repeating pattern detected
@@ -201,15 +502,23 @@ namespace HybridPred
 
     /**
      * Reachable region (physics-based)
+     *
+     * A disc of max_radius, or - when walls cut it (NavGrid) - the star-shaped
+     * polygon through boundary_points (one ray per Tables::BOUNDARY_CIRCLE
+     * direction, each clipped at the first wall).
      */
     struct ReachableRegion
     {
         math::vector3 center;            // Center of reachable region
         float max_radius;                // Maximum reachable distance
-        std::vector<math::vector3> boundary_points; // Discretized boundary
+        FrameVector<math::vector3> boundary_points; // Discretized boundary (frame arena; copies use the heap)
         float area;                      // Total reachable area
+        bool terrain_clipped;            // Some boundary ray stopped at a wall (area < πr²)
+
+        ReachableRegion() : center{}, max_radius(0.f), area(0.f), terrain_clipped(false) {}
 
-        ReachableRegion() : center{}, max_radius(0.f), area(0.f) {}
+        // Point inside the region (disc test unless terrain_clipped)
+        bool contains(const math::vector3& point) const;
     };
 
     /**
@@ -225,44 +534,183 @@ namespace HybridPred
         math::vector3 origin;            // Grid origin (center)
         float total_probability;         // Normalization factor
 
-        BehaviorPDF() : cell_size(25.0f), origin{}, total_probability(0.f)
+        // Summed-area table: sat_grid[x + 1][z + 1] = sum of pdf_grid[0..x][0..z]
+        // Rebuilt by normalize() so region queries never sweep the full grid
+        float sat_grid[GRID_SIZE + 1][GRID_SIZE + 1];
+
+        // Active box: every cell outside [x_first, x_last] x [z_first, z_last] is zero
+        // (empty when first > last). Grown by add_weighted_sample, tightened by
+        // normalize(); sums, the SAT rebuild and region queries stay inside it.
+        // sat_grid entries outside the box are stale and never read.
+        int active_x_first, active_x_last;
+        int active_z_first, active_z_last;
+
+        BehaviorPDF() : cell_size(25.0f), origin{}, total_probability(0.f),
+            active_x_first(GRID_SIZE), active_x_last(-1), active_z_first(GRID_SIZE), active_z_last(-1)
         {
             for (int i = 0; i < GRID_SIZE; ++i)
                 for (int j = 0; j < GRID_SIZE; ++j)
                     pdf_grid[i][j] = 0.f;
+
+            for (int i = 0; i <= GRID_SIZE; ++i)
+                for (int j = 0; j <= GRID_SIZE; ++j)
+                    sat_grid[i][j] = 0.f;
         }
 
         // Sample PDF at world position
         float sample(const math::vector3& world_pos) const;
 
-        // Normalize PDF so total probability = 1
+        bool has_active_cells() const { return active_x_first <= active_x_last; }
+
+        // Zero the active box and empty it (reuse without a full 4 KB clear)
+        void clear();
+
+        // Normalize PDF so total probability = 1 (also rebuilds sat_grid)
         void normalize();
 
         // Add weighted sample to PDF
         void add_weighted_sample(const math::vector3& pos, float weight);
+
+        // Zero cells whose centers are walls (NavGrid), call before normalize()
+        // Leaves the grid untouched if that would remove all mass
+        void mask_unwalkable();
+
+        /**
+         * Region probability queries (summed-area table, valid after normalize())
+         *
+         * Each query returns the probability mass of all cells whose centers fall
+         * inside the region - the same membership rule as a full grid sweep, but
+         * evaluated as one O(1) span lookup per grid row.
+         */
+
+        // Axis-aligned world rectangle [min_x, max_x] x [min_z, max_z] - O(1)
+        float rect_probability(float min_x, float min_z, float max_x, float max_z) const;
+
+        // Circle of radius around center - O(rows)
+        float circle_probability(const math::vector3& center, float radius) const;
+
+        // Oriented strip: segment start -> start + direction * length swept by
+        // half_width, with round caps (same shape as a linear skillshot capsule) - O(rows)
+        float strip_probability(const math::vector3& start, const math::vector3& direction,
+            float length, float half_width) const;
+
+        // Circular sector: apex, axis direction, half_angle (radians) and range - O(rows)
+        float cone_probability(const math::vector3& apex, const math::vector3& direction,
+            float half_angle, float range) const;
+
+    private:
+        // Mass of cells [z_first, z_last] in row x (inclusive, pre-clamped)
+        float row_span_probability(int x, int z_first, int z_last) const;
+
+        // Convert world interval along one axis to the inclusive cell range whose
+        // centers lie inside it, clipped to [axis_first, axis_last] (the active box).
+        // Returns false if no cell center is covered.
+        bool cell_range(float origin_axis, float lo, float hi, int axis_first, int axis_last,
+            int& first, int& last) const;
+
+        // Shrink the active box to the non-zero cells
+        void fit_active_box();
+
+        // World coordinate of a cell center along one axis
+        float cell_center(float origin_axis, int index) const
+        {
+            return origin_axis + (index - GRID_SIZE / 2 + 0.5f) * cell_size;
+        }
+    };
+
+    /**
+     * Compact copy of a normalized BehaviorPDF: the active box only, quantized
+     * to 16 bits per cell against the box's peak mass
+     *
+     * A stationary / CC'd target (single 5x5 splat) is 50 bytes of cells instead
+     * of the dense grid + SAT (~8 KB). Background worker results are kept in this
+     * form (PredictionWorker.h) and expanded into the tracker cache on use.
+     */
+    struct CompactBehaviorPDF
+    {
+        math::vector3 origin;
+        float cell_size = 25.f;
+        float total_probability = 0.f;
+        float quantum = 0.f;             // Mass per 16-bit step
+        int x_first = 0;
+        int z_first = 0;
+        int rows = 0;                    // Active box extent (x)
+        int columns = 0;                 // Active box extent (z)
+        std::vector<uint16_t> cells;     // rows * columns, row-major (capacity reused)
+
+        void compress(const BehaviorPDF& pdf);
+
+        // Overwrite pdf (dense grid, active box, SAT via normalize())
+        void expand(BehaviorPDF& pdf) const;
     };
 
     /**
      * Opportunistic casting opportunity window
      * Tracks recent predictions to detect peak opportunities
+     *
+     * Fixed storage, O(1) amortized per update: the sliding-window maximum is a
+     * monotonic queue of sample sequence numbers (hit_chance non-increasing
+     * front to back), and the last-second average is a running sum whose start
+     * advances with the clock. Queries refer to the time of the last update().
      */
     struct OpportunityWindow
     {
-        std::deque<std::pair<float, float>> history;  // (timestamp, hit_chance) last 3s
-        float peak_hit_chance;                         // Best hit_chance seen in window
-        float peak_timestamp;                          // When peak occurred
-        float window_start_time;                       // When tracking began for this spell
-        float last_hit_chance;                         // Last hit_chance (for reset detection)
+        static constexpr size_t HISTORY_CAPACITY = 200;  // Lag-spike cap (240Hz x 10s would be 2400)
+        static constexpr float WINDOW_DURATION = 3.0f;   // History span
+        static constexpr float PEAK_LIFETIME = 2.0f;     // Peak older than this falls back to the window max
+        static constexpr float RECENT_DURATION = 1.0f;   // Span of the recent average
+
+        struct Sample
+        {
+            float timestamp;
+            float hit_chance;
+        };
+
+        FixedRing<Sample, HISTORY_CAPACITY> history;     // Last 3s, oldest first
+        FixedRing<uint32_t, HISTORY_CAPACITY> max_queue; // Sequence numbers, front = window maximum
+        uint32_t next_sequence;                          // history[i] is sequence next_sequence - size + i
+        uint32_t recent_start;                           // Oldest sample within RECENT_DURATION
+        double recent_sum;                               // hit_chance sum over [recent_start, next_sequence)
+        float peak_hit_chance;                           // Best hit_chance seen in window
+        float peak_timestamp;                            // When peak occurred
+        float window_start_time;                         // When tracking began for this spell
+        float last_hit_chance;                           // Last hit_chance (for reset detection)
+        bool in_use;                                     // Tracking started (first request for the slot)
+
+        OpportunityWindow() : next_sequence(0), recent_start(0), recent_sum(0.0), peak_hit_chance(0.f),
+            peak_timestamp(0.f), window_start_time(0.f), last_hit_chance(0.f), in_use(false) {}
 
-        OpportunityWindow() : peak_hit_chance(0.f), peak_timestamp(0.f), window_start_time(0.f), last_hit_chance(0.f) {}
+        // Drop all samples and start tracking at start_time
+        void reset(float start_time);
 
         void update(float current_time, float hit_chance);
-        bool is_peak_opportunity(float current_time, float hit_chance, float adaptive_threshold, float elapsed_time, float patience_window) const;
+        bool is_peak_opportunity(float hit_chance, float adaptive_threshold, float elapsed_time, float patience_window) const;
         float get_adaptive_threshold(float base_threshold, float elapsed_time) const;
+
+    private:
+        uint32_t first_sequence() const { return next_sequence - static_cast<uint32_t>(history.size()); }
+        const Sample& sample(uint32_t sequence) const { return history[sequence - first_sequence()]; }
+        void pop_oldest();
+    };
+
+    constexpr int OPPORTUNITY_SLOT_COUNT = 12;      // Spell slots -1..10 (opportunity windows)
+
+    /**
+     * Optional debug/analysis payload (drawing, reasoning output)
+     * Only allocated when PredictionConfig::enable_prediction_debug is set
+     */
+    struct HybridPredictionDebug
+    {
+        ReachableRegion reachable_region;
+        BehaviorPDF behavior_pdf;
+        std::string reasoning;           // Mathematical explanation (HYBRID_PRED_ENABLE_REASONING)
     };
 
     /**
      * Complete prediction result
+     *
+     * Hot path: scalars only. Heavy analysis data lives in the shared debug
+     * payload so copies (frame cache, SDK conversion) stay cheap.
      */
     struct HybridPredictionResult
     {
@@ -278,23 +726,53 @@ namespace HybridPred
         float opportunity_score;         // [0-1] How good is this moment relative to recent history?
         float adaptive_threshold;        // Threshold adjusted for time waited (decays from base)
 
-        // Debugging/analysis data
-        ReachableRegion reachable_region;
-        BehaviorPDF behavior_pdf;
-        std::string reasoning;           // Mathematical explanation
+        // Short static status / failure reason (string literal, never owned)
+        const char* reason;
+
+        // Debugging/analysis data (null unless debug mode requests it)
+        std::shared_ptr<HybridPredictionDebug> debug;
 
         bool is_valid;
 
         HybridPredictionResult() : cast_position{}, first_cast_position{}, hit_chance(0.f),
             physics_contribution(0.f), behavior_contribution(0.f),
             confidence_score(0.f), is_peak_opportunity(false), opportunity_score(0.f),
-            adaptive_threshold(0.f), is_valid(false) {}
+            adaptive_threshold(0.f), reason(""), is_valid(false) {}
+    };
+
+    /**
+     * Cache counters (cumulative until reset)
+     */
+    struct CacheStats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;          // Entries dropped (frame flush / LRU replacement)
+
+        float hit_rate() const
+        {
+            uint64_t total = hits + misses;
+            return total > 0 ? static_cast<float>(hits) / total : 0.f;
+        }
+
+        CacheStats& operator+=(const CacheStats& other)
+        {
+            hits += other.hits;
+            misses += other.misses;
+            evictions += other.evictions;
+            return *this;
+        }
     };
 
     // =========================================================================
     // BEHAVIOR TRACKER (Per-Target Learning)
     // =========================================================================
 
+    constexpr int PDF_CACHE_SLOTS = 4;              // Prediction-time buckets cached per tracker
+
+    struct ProfileRecord;
+    struct ProfileObservation;
+
     /**
      * Tracks movement patterns for a specific target
      */
@@ -302,55 +780,162 @@ namespace HybridPred
     {
     private:
         game_object* target_;
-        std::deque<MovementSnapshot> movement_history_;
+        MovementHistory movement_history_;
         DodgePattern dodge_pattern_;
         float last_update_time_;
+        mutable PathCache path_cache_;
 
-        // Direction change tracking
-        std::vector<float> direction_change_times_;
-        std::vector<float> direction_change_angles_;
+        // Direction change tracking (sliding window over history, at most one per sample)
+        FixedRing<float, MOVEMENT_HISTORY_SIZE> direction_change_times_;
+        FixedRing<float, MOVEMENT_HISTORY_SIZE> direction_change_angles_;
+
+        /**
+         * Per-sample pattern classification, index-aligned with movement_history_
+         * Entry i describes the velocity pair (i-1, i) and the turn (i-2, i), so a
+         * sample's contribution is computed once on entry and subtracted on exit.
+         */
+        struct SampleAnalysis
+        {
+            enum Flags : uint8_t
+            {
+                MOVING_PAIR = 1 << 0,    // Both (i-1) and i moving (> 10 u/s)
+                LEFT = 1 << 1,
+                RIGHT = 1 << 2,
+                FORWARD = 1 << 3,
+                BACKWARD = 1 << 4,
+                TURN = 1 << 5            // > ~30 degree change vs sample i-2
+            };
+
+            uint8_t flags = 0;
+            int8_t juke = 0;             // -1 left, 0 straight, 1 right (valid with MOVING_PAIR)
+        };
+        FixedRing<SampleAnalysis, MOVEMENT_HISTORY_SIZE> sample_analysis_;
+
+        // Running window statistics (pairs/turns with history index >= 2)
+        int left_count_;
+        int right_count_;
+        int forward_count_;
+        int backward_count_;
+        int moving_pair_count_;
+        double interval_sq_sum_;         // Σ (Δt)² over consecutive direction changes
+        double lateral_sum_;             // Σ |sin(angle)| over direction changes
 
         // Auto-attack tracking
         float last_aa_time_;
-        std::vector<float> post_aa_movement_delays_;
+        static constexpr size_t POST_AA_DELAY_SAMPLES = 20;
+        FixedRing<float, POST_AA_DELAY_SAMPLES> post_aa_movement_delays_;
 
         // PDF caching (avoid rebuilding for multiple spells on same frame)
-        mutable BehaviorPDF cached_pdf_;
-        mutable float cached_prediction_time_;
-        mutable float cached_move_speed_;
-        mutable float cached_timestamp_;
+        // Fixed LRU slots: a 0.25s Q and a 1.0s R on the same frame each keep their own entry
+        struct PDFCacheEntry
+        {
+            BehaviorPDF pdf;             // Contextual factors already applied
+            float prediction_time = -1.f;
+            float move_speed = -1.f;
+            float timestamp = -1.f;
+            uint32_t last_used = 0;      // LRU stamp
+        };
+
+        mutable std::array<PDFCacheEntry, PDF_CACHE_SLOTS> pdf_cache_;
+        mutable uint32_t pdf_cache_clock_;
+        mutable CacheStats pdf_cache_stats_;
 
-        // Opportunistic casting tracking (per spell slot)
-        mutable std::unordered_map<int, OpportunityWindow> opportunity_windows_;
+        // Opportunistic casting tracking (indexed by spell slot + 1)
+        mutable std::array<OpportunityWindow, OPPORTUNITY_SLOT_COUNT> opportunity_windows_;
+
+        // Relevance tier (sampling rate + pattern cadence)
+        TrackerLod lod_;
+        int samples_since_analysis_;
+
+        // Champion prior (ProfileStore): blended into the dodge, juke and reaction
+        // statistics as profile_prior_weight_ pseudo-samples, fading as live data accumulates
+        DodgePattern profile_prior_;
+        float profile_prior_weight_;
+        uint32_t profile_hash_;                  // 0 = not a profiled champion
 
     public:
         TargetBehaviorTracker(game_object* target);
 
-        // Update tracking data (call every frame)
+        // Update tracking data (call every frame; samples at the LOD tier's interval)
         void update();
 
+        /**
+         * Change the relevance tier; moving to a finer tier publishes any
+         * pattern analysis skipped by the coarser cadence immediately
+         * History is kept: until it turns over, the window still holds samples
+         * taken at the coarser interval (velocities use their real time deltas)
+         */
+        void set_lod(TrackerLod lod);
+        TrackerLod get_lod() const { return lod_; }
+
+        /**
+         * Append a sampled snapshot (velocity computed from the previous sample)
+         * update() samples target_ and forwards here; trace replay feeds recorded samples
+         */
+        void ingest_snapshot(MovementSnapshot snapshot);
+
         // Get learned patterns
+        game_object* get_target() const { return target_; }
+        void set_target(game_object* target) { target_ = target; }
         const DodgePattern& get_dodge_pattern() const { return dodge_pattern_; }
-        const std::deque<MovementSnapshot>& get_history() const { return movement_history_; }
+        const MovementHistory& get_history() const { return movement_history_; }
+
+        // Target's current waypoint path (re-indexed only when the move order changes)
+        const PathCache& get_path_cache() const;
 
         // Analyze movement to detect patterns
         void analyze_patterns();
 
-        // Build probability distribution for future position
+        // Build probability distribution for future position (uncached, no contextual factors)
         BehaviorPDF build_behavior_pdf(float prediction_time, float move_speed) const;
 
+        /**
+         * Cached PDF for this frame (with contextual factors applied)
+         * Reference stays valid until the next cache miss on this tracker (a miss
+         * on a new frame may rebuild any slot); copy it to keep it longer
+         */
+        const BehaviorPDF& get_behavior_pdf(float prediction_time, float move_speed) const;
+
+        const CacheStats& get_pdf_cache_stats() const { return pdf_cache_stats_; }
+
+        /**
+         * Copy everything build_behavior_pdf / apply_contextual_factors read
+         * (history, learned patterns, juke statistics) into snapshot; caches and
+         * target stay untouched. Background PDF worker input (PredictionWorker.h).
+         */
+        void copy_pdf_inputs(TargetBehaviorTracker& snapshot) const;
+
         // Check if target is in animation lock
         bool is_animation_locked() const;
 
         // Get current velocity
         math::vector3 get_current_velocity() const;
 
-        // Opportunistic casting - get or create window for spell slot
+        // Opportunistic casting - get or create window for spell slot (-1..10)
         OpportunityWindow& get_opportunity_window(int spell_slot) const;
 
+        /**
+         * Seed learned patterns from the champion's stored profile (fresh trackers)
+         * record may be nullptr (first game on this champion): only the hash is kept
+         */
+        void apply_profile(uint32_t champion_hash, const ProfileRecord* record);
+        bool has_profile_prior() const { return profile_prior_weight_ > 0.f; }
+        uint32_t get_profile_hash() const { return profile_hash_; }
+
+        /**
+         * Live (prior-free) statistics for the profile store
+         * False until the window holds MIN_SAMPLES_FOR_BEHAVIOR moving pairs
+         */
+        bool observe_profile(ProfileObservation& out) const;
+
     private:
         void update_dodge_pattern();
         void detect_direction_changes();
+
+        // O(1) sliding-window maintenance after a push (evicted = oldest sample was dropped)
+        void update_running_statistics(bool evicted);
+        void add_sample_statistics(const SampleAnalysis& sample, float timestamp, float turn_angle);
+        void retire_sample_statistics(const SampleAnalysis& sample);
         math::vector3 compute_velocity(const MovementSnapshot& prev, const MovementSnapshot& curr) const;
     };
 
@@ -375,7 +960,10 @@ namespace HybridPred
          * - Acceleration: a = min(a_max, (v_max - v₀)/t)
          * - Turn rate constraint: Δθ ≤ ω * t
          * - Deceleration: can stop within distance
+         *
+         * TIER selects the boundary ray count (terrain clipping)
          */
+        template<QualityTier TIER = QualityTier::full>
         static ReachableRegion compute_reachable_region(
             const math::vector3& current_pos,
             const math::vector3& current_velocity,
@@ -398,7 +986,10 @@ namespace HybridPred
          * Compute physics-based hit probability
          *
          * P_physics = (projectile_area ∩ reachable_area) / reachable_area
+         *
+         * TIER selects the spiral sample count (wall-clipped regions)
          */
+        template<QualityTier TIER = QualityTier::full>
         static float compute_physics_hit_probability(
             const math::vector3& cast_position,
             float projectile_radius,
@@ -415,6 +1006,24 @@ namespace HybridPred
             float cast_delay
         );
 
+        /**
+         * Exact area of disk (center, radius) ∩ capsule (segment start -> end, capsule_radius)
+         */
+        static float disk_capsule_intersection_area(
+            const math::vector3& center, float radius,
+            const math::vector3& capsule_start, const math::vector3& capsule_end, float capsule_radius
+        );
+
+        /**
+         * Exact area of disk (center, radius) ∩ circular sector
+         * (apex sector_origin, unit sector_direction, half_angle in radians, sector_range)
+         */
+        static float disk_sector_intersection_area(
+            const math::vector3& center, float radius,
+            const math::vector3& sector_origin, const math::vector3& sector_direction,
+            float half_angle, float sector_range
+        );
+
     private:
         static float circle_circle_intersection_area(
             const math::vector3& c1, float r1,
@@ -442,7 +1051,7 @@ namespace HybridPred
          * - K is a kernel function (Gaussian)
          * - pᵢ(t) is predicted position from snapshot i
          */
-        static BehaviorPDF build_pdf_from_history(
+        static const BehaviorPDF& build_pdf_from_history(
             const TargetBehaviorTracker& tracker,
             float prediction_time,
             float move_speed
@@ -484,6 +1093,36 @@ namespace HybridPred
     // HYBRID FUSION ENGINE
     // =========================================================================
 
+    /**
+     * One target of a multi-target AoE search (PredictionManager::predict_aoe)
+     */
+    struct AoeTargetInput
+    {
+        game_object* target = nullptr;
+        TargetBehaviorTracker* tracker = nullptr;
+        EdgeCases::EdgeCaseAnalysis edge_cases;
+    };
+
+    struct AoeTargetHit
+    {
+        game_object* target = nullptr;
+        float hit_chance = 0.f;              // At the chosen cast position / direction
+    };
+
+    /**
+     * Multi-target AoE cast: one position (circular) or direction (cone / line)
+     * maximizing the expected number of targets hit
+     */
+    struct AoePredictionResult
+    {
+        math::vector3 cast_position{};       // Circle center, or source + direction * range
+        float expected_hits = 0.f;           // Sum of per-target hit chances
+        int hit_count = 0;                   // Targets at or above PredictionConfig::aoe_hit_threshold
+        std::vector<AoeTargetHit> targets;   // Every eligible target, hit or not
+        const char* reason = "";             // Static failure reason (string literal)
+        bool is_valid = false;               // hit_count >= min_hits
+    };
+
     /**
      * Combines physics and behavior using Bayesian fusion
      */
@@ -504,6 +1143,18 @@ namespace HybridPred
             TargetBehaviorTracker& tracker
         );
 
+        /**
+         * Same as above with precomputed edge case analysis (batched prediction:
+         * EdgeCases::analyze_target runs once per target instead of once per spell)
+         */
+        static HybridPredictionResult compute_hybrid_prediction(
+            game_object* source,
+            game_object* target,
+            const pred_sdk::spell_data& spell,
+            TargetBehaviorTracker& tracker,
+            const EdgeCases::EdgeCaseAnalysis& edge_cases
+        );
+
         /**
          * Compute confidence score
          *
@@ -523,7 +1174,10 @@ namespace HybridPred
 
         /**
          * Find optimal cast position using grid search + gradient ascent
+         * (branch-and-bound search when PredictionConfig enables it)
+         * Grid size, gradient probes and evaluation budget come from TIER
          */
+        template<QualityTier TIER = QualityTier::full>
         static math::vector3 find_optimal_cast_position(
             const ReachableRegion& reachable_region,
             const BehaviorPDF& behavior_pdf,
@@ -532,8 +1186,68 @@ namespace HybridPred
             float confidence
         );
 
+        /**
+         * Joint multi-target cast search
+         *
+         * Region, PDF (tracker cache / worker) and confidence are computed once
+         * per target, then every candidate cast is scored as
+         * E[hits] = Σ HitChance_i. Candidates are seeded from predicted centers
+         * and pairwise midpoints / bisectors and the best one is refined by
+         * pattern search. A candidate is dropped as soon as the targets whose
+         * reachable disc can still touch the spell cannot make min_hits, or their
+         * confidence sum (an upper bound on each fused hit chance) cannot beat
+         * the best expected hit count so far.
+         */
+        static AoePredictionResult compute_aoe_prediction(
+            game_object* source,
+            const std::vector<AoeTargetInput>& targets,
+            const pred_sdk::spell_data& spell,
+            int min_hits
+        );
+
     private:
-        // Spell-type specific prediction methods
+        // Spell slot reports a cast cone angle (Annie W, Cassiopeia R, ...)
+        static bool has_cast_cone(game_object* source, const pred_sdk::spell_data& spell);
+
+        /**
+         * Branch-and-bound cast position search
+         *
+         * Coarse pass over the reachable square, then best-first refinement of the
+         * top-K coarse cells (quadtree split). A cell of half-width h is bounded by
+         * evaluating its center with radius r + h√2: every hit circle centered in
+         * the cell lies inside that disk, and both physics and behavior terms are
+         * monotone in the covered region. Stops when no remaining cell's bound can
+         * beat the best score, or when max_evaluations is spent.
+         *
+         * Only valid against the analytic / spiral disk: terrain-clipped regions use
+         * sampled polygon coverage, which need not grow with the radius, so
+         * find_optimal_cast_position keeps the dense grid for them.
+         */
+        template<QualityTier TIER>
+        static math::vector3 find_optimal_cast_position_bnb(
+            const ReachableRegion& reachable_region,
+            const BehaviorPDF& behavior_pdf,
+            float projectile_radius,
+            float confidence,
+            int max_evaluations
+        );
+
+        /**
+         * Shape dispatch for one quality tier (cone, linear, circular, targeted, vector)
+         * Cone results skip the edge case multipliers, as before tiering
+         */
+        template<QualityTier TIER>
+        static HybridPredictionResult compute_shape_prediction(
+            game_object* source,
+            game_object* target,
+            const pred_sdk::spell_data& spell,
+            TargetBehaviorTracker& tracker,
+            const EdgeCases::EdgeCaseAnalysis& edge_cases,
+            bool is_cone
+        );
+
+        // Spell-type specific prediction methods (one instantiation per quality tier)
+        template<QualityTier TIER>
         static HybridPredictionResult compute_circular_prediction(
             game_object* source,
             game_object* target,
@@ -542,6 +1256,7 @@ namespace HybridPred
             const EdgeCases::EdgeCaseAnalysis& edge_cases
         );
 
+        template<QualityTier TIER>
         static HybridPredictionResult compute_linear_prediction(
             game_object* source,
             game_object* target,
@@ -558,6 +1273,7 @@ namespace HybridPred
             const EdgeCases::EdgeCaseAnalysis& edge_cases
         );
 
+        template<QualityTier TIER>
         static HybridPredictionResult compute_vector_prediction(
             game_object* source,
             game_object* target,
@@ -566,6 +1282,7 @@ namespace HybridPred
             const EdgeCases::EdgeCaseAnalysis& edge_cases
         );
 
+        template<QualityTier TIER>
         static HybridPredictionResult compute_cone_prediction(
             game_object* source,
             game_object* target,
@@ -582,6 +1299,7 @@ namespace HybridPred
             float capsule_radius
         );
 
+        template<QualityTier TIER = QualityTier::full>
         static float compute_capsule_reachability_overlap(
             const math::vector3& capsule_start,
             const math::vector3& capsule_direction,
@@ -598,6 +1316,7 @@ namespace HybridPred
             const BehaviorPDF& pdf
         );
 
+        template<QualityTier TIER = QualityTier::full>
         static float evaluate_hit_chance_at_point(
             const math::vector3& point,
             const ReachableRegion& reachable_region,
@@ -615,6 +1334,7 @@ namespace HybridPred
             float cone_range
         );
 
+        template<QualityTier TIER = QualityTier::full>
         static float compute_cone_reachability_overlap(
             const math::vector3& cone_origin,
             const math::vector3& cone_direction,
@@ -641,6 +1361,7 @@ namespace HybridPred
             float behavior_prob = 0.f;
         };
 
+        template<QualityTier TIER>
         static VectorConfiguration optimize_vector_orientation(
             game_object* source,
             const math::vector3& predicted_target_pos,
@@ -664,15 +1385,317 @@ namespace HybridPred
     // GLOBAL TRACKER MANAGER
     // =========================================================================
 
+    /**
+     * Frame result cache key
+     *
+     * Quantized spell_data + source state: repeated predict() calls for the same
+     * target and spell within one game tick (combo check, cast, draw) map to the
+     * same key even with float noise in the spell fields.
+     */
+    struct PredictionCacheKey
+    {
+        uint32_t target_id = 0;
+        uint32_t source_id = 0;
+        int32_t source_x = 0;            // Source position, 1 unit
+        int32_t source_z = 0;
+        int32_t range = 0;               // Distances, 1 unit
+        int32_t radius = 0;
+        int32_t cast_range = 0;
+        int32_t delay_ms = 0;            // Times, 1 ms
+        int32_t proc_delay_ms = 0;
+        int32_t projectile_speed = 0;    // Clamped (FLT_MAX = no projectile)
+        int32_t expected_hitchance = 0;
+        int32_t spell_slot = 0;
+        uint32_t collision_mask = 0;     // Bit per forbidden pred_sdk::collision_type
+        uint8_t spell_type = 0;
+        uint8_t targetting_type = 0;
+
+        static PredictionCacheKey make(game_object* source, game_object* target, const pred_sdk::spell_data& spell);
+
+        bool operator==(const PredictionCacheKey& other) const = default;
+    };
+
+    struct PredictionCacheKeyHash
+    {
+        size_t operator()(const PredictionCacheKey& key) const;
+    };
+
+    /**
+     * Batched prediction output for one target
+     * results[i] corresponds to spells[i] of the predict_batch() call
+     */
+    struct BatchPrediction
+    {
+        game_object* target = nullptr;
+        EdgeCases::EdgeCaseAnalysis edge_cases;      // Shared by every spell for this target
+        std::vector<HybridPredictionResult> results;
+    };
+
+    // =========================================================================
+    // TRACKER POOL
+    // =========================================================================
+
+    /**
+     * Generation-checked reference to a pooled tracker
+     * Safe to hold across frames: resolves to nullptr once its slot is recycled
+     */
+    struct TrackerHandle
+    {
+        static constexpr uint16_t INVALID_SLOT = 0xFFFF;
+
+        uint16_t slot = INVALID_SLOT;
+        uint16_t generation = 0;
+
+        bool is_valid() const { return slot != INVALID_SLOT; }
+    };
+
+    /**
+     * Fixed-capacity contiguous tracker storage
+     *
+     * Trackers live in one slot array allocated on first use. Network ids map to
+     * slots through a small open-addressed index (linear probing, backward-shift
+     * deletion). Each release bumps the slot generation, invalidating handles.
+     * When full, the least recently used evictable (non-champion) tracker is
+     * recycled; champion trackers are only released by PredictionManager::update.
+     */
+    class TrackerPool
+    {
+    public:
+        static constexpr size_t CAPACITY = MAX_TRACKERS;
+
+        size_t capacity() const { return CAPACITY; }
+        size_t size() const { return count_; }
+
+        bool is_occupied(size_t slot) const { return slots_[slot].occupied; }
+        uint32_t network_id(size_t slot) const { return slots_[slot].network_id; }
+        float last_used(size_t slot) const { return slots_[slot].last_used; }      // Last acquire (predict) time
+        TargetBehaviorTracker& at(size_t slot) { return *trackers_[slot]; }
+        const TargetBehaviorTracker& at(size_t slot) const { return *trackers_[slot]; }
+
+        TrackerHandle find(uint32_t network_id) const
+        {
+            uint16_t slot = index_lookup(network_id);
+            return slot == EMPTY ? TrackerHandle{} : TrackerHandle{ slot, slots_[slot].generation };
+        }
+
+        /**
+         * Existing tracker for target, else a new one (invalid handle if the pool is
+         * full of non-evictable trackers). last_used feeds LRU recycling;
+         * created reports whether a fresh tracker was constructed.
+         */
+        TrackerHandle acquire(game_object* target, bool evictable, float current_time, bool* created = nullptr)
+        {
+            if (created)
+                *created = false;
+
+            uint32_t id = target->get_network_id();
+            uint16_t slot = index_lookup(id);
+            if (slot != EMPTY)
+            {
+                slots_[slot].last_used = current_time;
+                return TrackerHandle{ slot, slots_[slot].generation };
+            }
+
+            slot = free_slot();
+            if (slot == EMPTY)
+                return TrackerHandle{};
+
+            if (!trackers_)
+                trackers_ = std::make_unique<std::optional<TargetBehaviorTracker>[]>(CAPACITY);
+
+            trackers_[slot].emplace(target);
+            SlotInfo& info = slots_[slot];
+            info.network_id = id;
+            info.occupied = true;
+            info.evictable = evictable;
+            info.last_used = current_time;
+            index_insert(id, slot);
+            ++count_;
+            if (created)
+                *created = true;
+
+            return TrackerHandle{ slot, info.generation };
+        }
+
+        TargetBehaviorTracker* resolve(TrackerHandle handle) const
+        {
+            if (!handle.is_valid() || handle.slot >= CAPACITY)
+                return nullptr;
+
+            const SlotInfo& info = slots_[handle.slot];
+            if (!info.occupied || info.generation != handle.generation)
+                return nullptr;
+
+            return &*trackers_[handle.slot];
+        }
+
+        void release(size_t slot)
+        {
+            SlotInfo& info = slots_[slot];
+            if (!info.occupied)
+                return;
+
+            index_erase(info.network_id);
+            trackers_[slot].reset();
+            info.occupied = false;
+            ++info.generation;
+            --count_;
+        }
+
+        // Release every tracker and free the slot array (generations survive)
+        void clear()
+        {
+            for (size_t slot = 0; slot < CAPACITY; ++slot)
+                release(slot);
+            trackers_.reset();
+        }
+
+    private:
+        static constexpr uint16_t EMPTY = 0xFFFF;
+        static constexpr size_t INDEX_SIZE = CAPACITY * 2;              // Load factor <= 0.5
+        static_assert((INDEX_SIZE & (INDEX_SIZE - 1)) == 0, "INDEX_SIZE must be a power of two");
+
+        struct SlotInfo
+        {
+            uint32_t network_id = 0;
+            uint16_t generation = 0;
+            bool occupied = false;
+            bool evictable = false;
+            float last_used = 0.f;
+        };
+
+        static size_t home(uint32_t network_id)
+        {
+            return (network_id * 2654435761u) & (INDEX_SIZE - 1);      // Fibonacci hash
+        }
+
+        uint16_t index_lookup(uint32_t network_id) const
+        {
+            for (size_t i = home(network_id); index_[i] != EMPTY; i = (i + 1) & (INDEX_SIZE - 1))
+            {
+                if (slots_[index_[i]].network_id == network_id)
+                    return index_[i];
+            }
+            return EMPTY;
+        }
+
+        void index_insert(uint32_t network_id, uint16_t slot)
+        {
+            size_t i = home(network_id);
+            while (index_[i] != EMPTY)
+                i = (i + 1) & (INDEX_SIZE - 1);
+            index_[i] = slot;
+        }
+
+        void index_erase(uint32_t network_id)
+        {
+            size_t hole = home(network_id);
+            while (index_[hole] != EMPTY && slots_[index_[hole]].network_id != network_id)
+                hole = (hole + 1) & (INDEX_SIZE - 1);
+            if (index_[hole] == EMPTY)
+                return;
+
+            // Backward shift: pull later entries of the probe run into the hole
+            index_[hole] = EMPTY;
+            for (size_t i = (hole + 1) & (INDEX_SIZE - 1); index_[i] != EMPTY; i = (i + 1) & (INDEX_SIZE - 1))
+            {
+                size_t distance_to_hole = (hole - home(slots_[index_[i]].network_id)) & (INDEX_SIZE - 1);
+                size_t distance_to_entry = (i - home(slots_[index_[i]].network_id)) & (INDEX_SIZE - 1);
+                if (distance_to_hole <= distance_to_entry)
+                {
+                    index_[hole] = index_[i];
+                    index_[i] = EMPTY;
+                    hole = i;
+                }
+            }
+        }
+
+        // First free slot, else recycle the least recently used evictable tracker
+        uint16_t free_slot()
+        {
+            size_t victim = CAPACITY;
+            for (size_t slot = 0; slot < CAPACITY; ++slot)
+            {
+                const SlotInfo& info = slots_[slot];
+                if (!info.occupied)
+                    return static_cast<uint16_t>(slot);
+                if (info.evictable && (victim == CAPACITY || info.last_used < slots_[victim].last_used))
+                    victim = slot;
+            }
+
+            if (victim == CAPACITY)
+                return EMPTY;
+
+            release(victim);
+            return static_cast<uint16_t>(victim);
+        }
+
+        std::unique_ptr<std::optional<TargetBehaviorTracker>[]> trackers_;   // CAPACITY contiguous slots
+        std::array<SlotInfo, CAPACITY> slots_{};
+        std::array<uint16_t, INDEX_SIZE> index_ = make_empty_index();
+        size_t count_ = 0;
+
+        static constexpr std::array<uint16_t, INDEX_SIZE> make_empty_index()
+        {
+            std::array<uint16_t, INDEX_SIZE> index{};
+            for (auto& entry : index)
+                entry = EMPTY;
+            return index;
+        }
+    };
+
     /**
      * Manages behavior trackers for all enemy targets
      */
     class PredictionManager
     {
     private:
-        static inline std::unordered_map<uint32_t, std::unique_ptr<TargetBehaviorTracker>> trackers_;
+        static inline TrackerPool trackers_;
         static inline float last_update_time_;
 
+        // Frame-scoped result cache (flushed whenever the game clock advances)
+        // Flat list scanned by hash: a tick holds a few dozen entries, and the
+        // retained capacity keeps steady-state inserts off the heap
+        struct FrameCacheEntry
+        {
+            size_t hash;
+            PredictionCacheKey key;
+            HybridPredictionResult result;
+        };
+
+        static inline std::vector<FrameCacheEntry> frame_cache_;
+        static inline float frame_cache_time_ = -1.f;
+        static inline CacheStats cache_stats_;
+
+        static void invalidate_frame_cache(float current_time);
+
+        // Fold one tracker's live statistics into ProfileStore (once per tracker lifetime)
+        static bool harvest_profile(const TargetBehaviorTracker& tracker);
+
+        // Harvest every live tracker and schedule writeback (clear)
+        static void harvest_profiles();
+
+        // Relevance tier from visibility, distance to the local player and recent predict() use
+        static TrackerLod select_lod(game_object* target, game_object* local_player,
+            float last_requested, float current_time);
+
+        // Per-target setup shared by predict() and predict_batch(): tracker lookup and
+        // edge case analysis (nullptr: invalid target)
+        static TargetBehaviorTracker* prepare_target(
+            game_object* source,
+            game_object* target,
+            EdgeCases::EdgeCaseAnalysis& edge_cases
+        );
+
+        // Frame cache lookup, computing on miss
+        static HybridPredictionResult predict_cached(
+            game_object* source,
+            game_object* target,
+            const pred_sdk::spell_data& spell,
+            TargetBehaviorTracker& tracker,
+            const EdgeCases::EdgeCaseAnalysis& edge_cases
+        );
+
     public:
         /**
          * Update all trackers (call every frame)
@@ -680,12 +1703,25 @@ namespace HybridPred
         static void update();
 
         /**
-         * Get or create tracker for target
+         * Get or create tracker for target (nullptr if invalid or the pool is full)
          */
         static TargetBehaviorTracker* get_tracker(game_object* target);
 
+        /**
+         * Get or create tracker for target as a handle that can be held across frames
+         */
+        static TrackerHandle acquire_tracker(game_object* target);
+
+        /**
+         * Tracker behind handle, nullptr once it was released or recycled
+         */
+        static TargetBehaviorTracker* resolve_tracker(TrackerHandle handle) { return trackers_.resolve(handle); }
+
+        static const TrackerPool& get_trackers() { return trackers_; }
+
         /**
          * Get hybrid prediction for target
+         * Same per-target setup as predict_batch(), without the batch allocations
          */
         static HybridPredictionResult predict(
             game_object* source,
@@ -694,83 +1730,50 @@ namespace HybridPred
         );
 
         /**
-         * Clear all tracking data
+         * Predict every (target, spell) pair in one call
+         *
+         * Per-target work (tracker lookup, edge case analysis) runs once and is
+         * shared across spells. The reachable region and behavior PDF depend on
+         * each spell's arrival time, so they are built per spell; spells with
+         * matching timing share the tracker's cached PDF.
+         * Invalid targets are skipped, so the output may be shorter than targets.
          */
-        static void clear();
-    };
-
-#if ENABLE_PATTERN_TELEMETRY
-    // =========================================================================
-    // PATTERN TELEMETRY (OPTIONAL)
-    // =========================================================================
-
-    /**
-     * Tracks pattern detection effectiveness for post-game analysis
-     * Prints comprehensive recap when game ends
-     */
-    class PatternTelemetry
-    {
-    private:
-        struct PatternSample
-        {
-            std::string champion;
-            bool had_pattern;
-            int pattern_type;  // 0=alternating, 1=repeating
-            float confidence;
-            float prediction_error;
-        };
-
-        struct OpportunitySample
-        {
-            bool was_peak;
-            float wait_time;
-            bool was_taken;
-        };
-
-        static inline std::vector<PatternSample> samples_;
-        static inline std::vector<OpportunitySample> opportunities_;
-        static inline float game_start_time_;
-        static inline bool enabled_;
-
-    public:
-        static void init()
-        {
-            samples_.clear();
-            opportunities_.clear();
-            game_start_time_ = g_sdk->clock_facade->get_game_time();
-            enabled_ = true;
-        }
+        static std::vector<BatchPrediction> predict_batch(
+            game_object* source,
+            const std::vector<game_object*>& targets,
+            const std::vector<pred_sdk::spell_data>& spells
+        );
 
-        static void set_enabled(bool enable) { enabled_ = enable; }
-        static bool is_enabled() { return enabled_; }
+        /**
+         * Best single AoE cast against several targets (Annie R, Amumu R, ...)
+         *
+         * Trackers and edge case analysis are looked up once per target and
+         * shared by every candidate; see HybridFusionEngine::compute_aoe_prediction.
+         * Duplicate and invalid targets are skipped.
+         */
+        static AoePredictionResult predict_aoe(
+            game_object* source,
+            const std::vector<game_object*>& targets,
+            const pred_sdk::spell_data& spell,
+            int min_hits
+        );
 
-        // Stub implementations - telemetry disabled
-        static void log_prediction(
-            const std::string& champion_name,
-            bool has_pattern,
-            int pattern_type,
-            float pattern_confidence,
-            float prediction_error)
-        {
-            // Telemetry disabled - no-op
-            (void)champion_name; (void)has_pattern; (void)pattern_type;
-            (void)pattern_confidence; (void)prediction_error;
-        }
+        /**
+         * Clear all tracking data
+         */
+        static void clear();
 
-        static void log_opportunity(
-            bool is_peak,
-            float elapsed_time,
-            bool cast_taken)
-        {
-            // Telemetry disabled - no-op
-            (void)is_peak; (void)elapsed_time; (void)cast_taken;
-        }
+        /**
+         * Frame result cache counters
+         */
+        static const CacheStats& get_cache_stats() { return cache_stats_; }
+        static void reset_cache_stats() { cache_stats_ = CacheStats{}; }
 
-        static void print_recap()
-        {
-            // Telemetry disabled - no-op
-        }
+        /**
+         * Behavior PDF cache counters summed over all live trackers
+         */
+        static CacheStats get_pdf_cache_stats();
     };
-#endif
+
 
 } // namespace HybridPred
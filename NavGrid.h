@@ -0,0 +1,198 @@
+#pragma once
+
+#include "sdk.hpp"
+#include "PredictionConfig.h"
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+/**
+ * =============================================================================
+ * WALKABILITY GRID
+ * =============================================================================
+ *
+ * Static bitmap of walkable terrain sampled from nav_mesh once at load.
+ *
+ * One bit per nav_grid_cell_size square (Summoner's Rift at 50 units is
+ * ~300x300 cells, ~11 KB), so reachable-region clipping, PDF masking and
+ * terrain collision become bit lookups instead of per-query navmesh calls.
+ * Terrain is static for the whole game; dynamic walls (Anivia W, Taliyah R)
+ * are not represented.
+ *
+ * Positions outside the sampled map, or queries before build(), are treated
+ * as walkable so missing data never removes probability mass.
+ *
+ * Usage:
+ *   NavGrid::build();                        // LoadPrediction
+ *   bool open = NavGrid::is_walkable(x, z);
+ *   float reach = NavGrid::clip_ray(start, dir_x, dir_z, max_distance);
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+    class NavGrid
+    {
+    public:
+        static constexpr int MAX_CELLS_PER_AXIS = 1024;     // Cell size grows past this extent
+
+        /**
+         * Sample nav_mesh over the terrain bounds (one-time, call at load)
+         */
+        static bool build()
+        {
+            clear();
+
+            if (!g_sdk || !g_sdk->nav_mesh)
+                return false;
+
+            math::vector3 terrain_start = g_sdk->nav_mesh->get_terrain_start();
+            math::vector3 terrain_end = g_sdk->nav_mesh->get_terrain_end();
+
+            float extent_x = terrain_end.x - terrain_start.x;
+            float extent_z = terrain_end.z - terrain_start.z;
+            if (extent_x <= 0.f || extent_z <= 0.f)
+                return false;
+
+            float cell_size = std::max(PredictionConfig::get().nav_grid_cell_size, 1.f);
+            cell_size = std::max(cell_size, std::max(extent_x, extent_z) / MAX_CELLS_PER_AXIS);
+
+            origin_x_ = terrain_start.x;
+            origin_z_ = terrain_start.z;
+            cell_size_ = cell_size;
+            inv_cell_ = 1.f / cell_size;
+            cells_x_ = std::min(MAX_CELLS_PER_AXIS, static_cast<int>(std::ceil(extent_x * inv_cell_)));
+            cells_z_ = std::min(MAX_CELLS_PER_AXIS, static_cast<int>(std::ceil(extent_z * inv_cell_)));
+
+            size_t cell_count = static_cast<size_t>(cells_x_) * cells_z_;
+            bits_.assign((cell_count + 63) / 64, 0);
+
+            // Sample each cell center once; row-major (x outer) bit order
+            for (int ix = 0; ix < cells_x_; ++ix)
+            {
+                for (int iz = 0; iz < cells_z_; ++iz)
+                {
+                    math::vector3 center(
+                        origin_x_ + (ix + 0.5f) * cell_size_,
+                        0.f,
+                        origin_z_ + (iz + 0.5f) * cell_size_);
+
+                    if (g_sdk->nav_mesh->is_pathable(center))
+                    {
+                        size_t index = static_cast<size_t>(ix) * cells_z_ + iz;
+                        bits_[index >> 6] |= uint64_t{ 1 } << (index & 63);
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        static bool is_built() { return !bits_.empty(); }
+
+        static float get_cell_size() { return cell_size_; }
+
+        /**
+         * Walkable terrain at (x, z); unknown positions count as walkable
+         */
+        static bool is_walkable(float x, float z)
+        {
+            if (bits_.empty())
+                return true;
+
+            int ix = static_cast<int>(std::floor((x - origin_x_) * inv_cell_));
+            int iz = static_cast<int>(std::floor((z - origin_z_) * inv_cell_));
+            if (ix < 0 || iz < 0 || ix >= cells_x_ || iz >= cells_z_)
+                return true;
+
+            size_t index = static_cast<size_t>(ix) * cells_z_ + iz;
+            return (bits_[index >> 6] >> (index & 63)) & 1;
+        }
+
+        static bool is_walkable(const math::vector3& position)
+        {
+            return is_walkable(position.x, position.z);
+        }
+
+        /**
+         * Distance along (dir_x, dir_z) from start before the first wall cell
+         * Marches in half-cell steps; returns max_distance if the path stays open
+         * or start itself is unwalkable (mid-dash / wall hop: nothing to clip against)
+         */
+        static float clip_ray(const math::vector3& start, float dir_x, float dir_z, float max_distance)
+        {
+            if (bits_.empty() || max_distance <= 0.f || !is_walkable(start.x, start.z))
+                return max_distance;
+
+            float step = cell_size_ * 0.5f;
+            for (float d = step; d < max_distance; d += step)
+            {
+                if (!is_walkable(start.x + dir_x * d, start.z + dir_z * d))
+                    return std::max(0.f, d - step);
+            }
+
+            if (!is_walkable(start.x + dir_x * max_distance, start.z + dir_z * max_distance))
+                return std::max(0.f, max_distance - step);
+
+            return max_distance;
+        }
+
+        /**
+         * True if the segment start -> end crosses a wall cell (terrain collision)
+         * The end cell and the last end_radius units are exempt: the projectile touches
+         * the hitbox there, and a unit hugging a wall may quantize into a wall cell
+         */
+        static bool segment_blocked(const math::vector3& start, const math::vector3& end, float end_radius = 0.f)
+        {
+            if (bits_.empty())
+                return false;
+
+            float dx = end.x - start.x;
+            float dz = end.z - start.z;
+            float length = std::sqrt(dx * dx + dz * dz);
+            float reach = length - std::max(end_radius, 0.f);
+            if (length < 1e-4f || reach < 0.f)
+                return false;
+
+            int end_ix = static_cast<int>(std::floor((end.x - origin_x_) * inv_cell_));
+            int end_iz = static_cast<int>(std::floor((end.z - origin_z_) * inv_cell_));
+
+            // No start-cell exemption here: a projectile fired from a wall still hits it
+            float step = cell_size_ * 0.5f;
+            float inv_length = 1.f / length;
+            for (float d = 0.f; d <= reach; d += step)
+            {
+                float x = start.x + dx * inv_length * d;
+                float z = start.z + dz * inv_length * d;
+                if (static_cast<int>(std::floor((x - origin_x_) * inv_cell_)) == end_ix &&
+                    static_cast<int>(std::floor((z - origin_z_) * inv_cell_)) == end_iz)
+                    continue;
+
+                if (!is_walkable(x, z))
+                    return true;
+            }
+
+            return false;
+        }
+
+        static void clear()
+        {
+            bits_.clear();
+            bits_.shrink_to_fit();
+            cells_x_ = 0;
+            cells_z_ = 0;
+        }
+
+    private:
+        static inline std::vector<uint64_t> bits_;            // 1 = walkable, cells_x_ * cells_z_ bits
+        static inline float origin_x_ = 0.f;
+        static inline float origin_z_ = 0.f;
+        static inline float cell_size_ = 50.f;
+        static inline float inv_cell_ = 1.f / 50.f;
+        static inline int cells_x_ = 0;
+        static inline int cells_z_ = 0;
+    };
+
+} // namespace HybridPred
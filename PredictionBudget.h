@@ -0,0 +1,128 @@
+#pragma once
+
+#include "HybridPrediction.h"
+#include "PredictionConfig.h"
+#include <chrono>
+#include <cstdint>
+
+/**
+ * =============================================================================
+ * PER-FRAME PREDICTION BUDGET
+ * =============================================================================
+ *
+ * Keeps the prediction work of one game_update close to a fixed wall-clock
+ * budget (PredictionConfig::prediction_frame_budget_ms), so a 5v5 fight with
+ * every champion script predicting costs about as much per frame as lane.
+ *
+ * HybridFusionEngine::compute_hybrid_prediction asks select_tier() which
+ * pipeline instantiation to run and charges its elapsed time to the frame
+ * (Scope). Below prediction_budget_reduced_fraction of the budget every call
+ * runs at QualityTier::full; past it calls drop to reduced, and past
+ * prediction_budget_minimal_fraction to minimal. Calls are never skipped: an
+ * overrun frame still answers everything, just with the cheapest tier.
+ *
+ * PredictionManager::update() starts each frame (begin_frame). Callers
+ * outside the frame loop (replay, tools) must disable the budget, otherwise
+ * the spent time never resets and every call ends up at minimal.
+ *
+ * Enable with PredictionConfig::enable_prediction_budget.
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+    class PredictionBudget
+    {
+    public:
+        struct Stats
+        {
+            uint64_t predictions[QUALITY_TIER_COUNT] = {};   // Calls per tier since load
+            uint64_t degraded_frames = 0;                    // Frames with at least one below-full call
+            float last_frame_us = 0.f;                       // Prediction time charged to the previous frame
+            float peak_frame_us = 0.f;
+        };
+
+        /**
+         * Close the previous frame's accounting (call at the start of every game_update)
+         */
+        static void begin_frame()
+        {
+            State& budget = state();
+            budget.stats.last_frame_us = budget.spent_us;
+            if (budget.spent_us > budget.stats.peak_frame_us)
+                budget.stats.peak_frame_us = budget.spent_us;
+            if (budget.degraded)
+                ++budget.stats.degraded_frames;
+
+            budget.spent_us = 0.f;
+            budget.degraded = false;
+        }
+
+        /**
+         * Tier for the next prediction, from the time this frame has spent so far
+         */
+        static QualityTier select_tier()
+        {
+            const auto& config = PredictionConfig::get();
+            if (!config.enable_prediction_budget || config.prediction_frame_budget_ms <= 0.f)
+                return QualityTier::full;
+
+            float budget_us = config.prediction_frame_budget_ms * 1000.f;
+            float spent_us = state().spent_us;
+
+            if (spent_us < budget_us * config.prediction_budget_reduced_fraction)
+                return QualityTier::full;
+            if (spent_us < budget_us * config.prediction_budget_minimal_fraction)
+                return QualityTier::reduced;
+            return QualityTier::minimal;
+        }
+
+        /**
+         * Charges its lifetime to the current frame (one prediction)
+         */
+        class Scope
+        {
+        public:
+            explicit Scope(QualityTier tier) :
+                tier_(tier),
+                start_(std::chrono::steady_clock::now())
+            {
+            }
+
+            ~Scope()
+            {
+                auto elapsed = std::chrono::steady_clock::now() - start_;
+                State& budget = state();
+                budget.spent_us += std::chrono::duration<float, std::micro>(elapsed).count();
+                ++budget.stats.predictions[static_cast<int>(tier_)];
+                if (tier_ != QualityTier::full)
+                    budget.degraded = true;
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            QualityTier tier_;
+            std::chrono::steady_clock::time_point start_;
+        };
+
+        static const Stats& get_stats() { return state().stats; }
+
+    private:
+        struct State
+        {
+            float spent_us = 0.f;                            // Charged to the current frame
+            bool degraded = false;
+            Stats stats;
+        };
+
+        static State& state()
+        {
+            static State instance;
+            return instance;
+        }
+    };
+
+} // namespace HybridPred
@@ -21,6 +21,60 @@ namespace PredictionConfig
         // Edge case toggles
         bool enable_dash_prediction = true;  // Predict at dash endpoints
 
+        // Performance toggles
+        bool enable_simd_kernels = true;     // SSE2/AVX2 grid and sampling kernels (scalar when false)
+        bool enable_tracker_lod = true;      // Sample far / fogged / unused trackers less often
+        bool use_analytic_reachability = true;   // Closed-form disk vs capsule / cone overlap (false: 128 spiral samples, validation)
+
+        // Cast position optimizer (circular spells)
+        bool use_branch_and_bound_optimizer = false;  // Coarse pass + bounded refinement instead of dense 16x16 grid
+        int cast_optimizer_eval_budget = 96;          // Max hit-chance evaluations per call (branch-and-bound only)
+        bool use_polar_vector_search = true;          // Vector spells: polar upper bounds prune exact line evaluations (same result)
+
+        // Per-frame prediction budget (see PredictionBudget.h)
+        bool enable_prediction_budget = true;         // Drop to cheaper pipeline tiers once a frame's budget is mostly spent
+        float prediction_frame_budget_ms = 2.0f;      // Wall-clock prediction time per game_update (0 = unlimited)
+        float prediction_budget_reduced_fraction = 0.6f;  // Spent share after which calls run the reduced tier
+        float prediction_budget_minimal_fraction = 0.85f; // Spent share after which calls run the minimal tier
+
+        // Multi-target AoE optimizer (PredictionManager::predict_aoe)
+        float aoe_hit_threshold = 0.3f;               // Per-target hit chance counted toward min_hits
+        int aoe_refine_iterations = 4;                // Pattern-search step halvings around the best seed
+
+        // Terrain (see NavGrid.h)
+        bool enable_terrain_awareness = true;         // Clip reachable regions / mask PDF cells at walls
+        float nav_grid_cell_size = 50.f;              // Walkability bitmap resolution (sampled once at load)
+
+        // Background PDF worker (see PredictionWorker.h)
+        bool enable_pdf_worker = false;               // Build per-target PDF buckets on a worker thread
+
+        // Persistent champion behavior profiles (see ProfileStore.h)
+        bool enable_behavior_profiles = true;         // Warm-start trackers from priors learned in earlier games
+        const char* profile_path = "DannyPred_profiles.bin";
+
+        // Result caching
+        bool enable_frame_result_cache = true;        // Reuse identical predict() results within one game tick
+        bool enable_edge_case_snapshot = true;        // Buff/windwall edge case checks once per target per tick
+
+        // Debug output
+        bool enable_prediction_debug = false;         // Attach region/PDF/reasoning payload to results (drawing, analysis)
+
+        // Logging (see PredictionLogger.h; HYBRID_PRED_LOG_LEVEL caps this at compile time)
+        int log_level = 3;                            // 0=off, 1=error, 2=warn, 3=info, 4=debug
+        int log_flush_interval_ms = 250;              // Min time between console flushes
+        int log_max_lines_per_flush = 8;              // Console lines formatted per flush
+
+        // Trace recording (offline replay / benchmark input, see PredictionTrace.h)
+        bool enable_trace_recording = false;          // Stream snapshots + prediction requests to trace_path
+        const char* trace_path = "DannyPred_trace.bin";
+
+        // Outcome telemetry (per-prediction / cast / hit records, see PredictionTelemetry.h)
+        bool enable_outcome_telemetry = true;         // Background-written columnar log, safe to leave on
+        const char* telemetry_path = "DannyPred_telemetry.bin";   // Per session: DannyPred_telemetry_<unix time>.bin
+
+        // Profiling (HYBRID_PRED_ENABLE_PROFILER builds only)
+        const char* profiler_dump_path = "DannyPred_profile.txt";  // Stage histogram dump on unload (empty = off)
+
         Settings() {}
     };
 
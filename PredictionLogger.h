@@ -0,0 +1,324 @@
+#pragma once
+
+#include "sdk.hpp"
+#include "PredictionConfig.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+/**
+ * =============================================================================
+ * STRUCTURED PREDICTION LOGGING
+ * =============================================================================
+ *
+ * Hot-path logging without formatting or console I/O on the prediction path.
+ *
+ * HYBRID_LOG_* macros compile away above HYBRID_PRED_LOG_LEVEL and are skipped
+ * at runtime above PredictionConfig::log_level; arguments are not evaluated
+ * when a level is disabled. Enabled events store a static format string and
+ * binary arguments in a lock-free single-producer ring. Log::flush() (called
+ * from CustomPredictionSDK::update_trackers) formats a bounded number of
+ * events at a throttled rate and forwards them to g_sdk->log_console.
+ *
+ * Format strings use {} placeholders: integers print as %lld, floating point
+ * as %.2f, strings as-is. const char* arguments must outlive the flush
+ * (string literals); std::string arguments are copied inline (truncated).
+ *
+ * Usage:
+ *   HYBRID_LOG_DEBUG("Target: {} | HitChance: {}", obj->get_char_name(), hit_chance);
+ *
+ * =============================================================================
+ */
+
+// Compile-time ceiling: 0=off, 1=error, 2=warn, 3=info, 4=debug
+#ifndef HYBRID_PRED_LOG_LEVEL
+    #define HYBRID_PRED_LOG_LEVEL 3
+#endif
+
+namespace HybridPred
+{
+    namespace Log
+    {
+        enum class Level : uint8_t
+        {
+            off = 0,
+            error,
+            warn,
+            info,
+            debug
+        };
+
+        constexpr size_t MAX_ARGS = 4;
+        constexpr size_t INLINE_STRING_SIZE = 24;
+        constexpr size_t RING_CAPACITY = 256;   // Power of two
+        static_assert((RING_CAPACITY & (RING_CAPACITY - 1)) == 0, "RING_CAPACITY must be a power of two");
+
+        // =====================================================================
+        // EVENT STORAGE
+        // =====================================================================
+
+        enum class ArgType : uint8_t
+        {
+            integer,
+            floating,
+            static_string,
+            inline_string
+        };
+
+        struct Arg
+        {
+            ArgType type;
+            union
+            {
+                long long i;
+                double f;
+                const char* s;
+            };
+        };
+
+        struct Event
+        {
+            float time = 0.f;
+            Level level = Level::off;
+            uint8_t arg_count = 0;
+            const char* format = "";
+            Arg args[MAX_ARGS];
+            char inline_string[INLINE_STRING_SIZE] = {};   // Storage for one std::string argument
+        };
+
+        namespace detail
+        {
+            struct Ring
+            {
+                Event events[RING_CAPACITY];
+                std::atomic<uint32_t> write_index{ 0 };    // Producer owned
+                std::atomic<uint32_t> read_index{ 0 };     // Consumer owned
+                std::atomic<uint32_t> dropped{ 0 };
+                float last_flush_time = -1.f;
+            };
+
+            inline Ring& ring()
+            {
+                static Ring instance;
+                return instance;
+            }
+
+            template<typename T>
+            inline void encode(Event& event, const T& value)
+            {
+                if (event.arg_count >= MAX_ARGS)
+                    return;
+
+                Arg& arg = event.args[event.arg_count++];
+                using V = std::decay_t<T>;
+
+                if constexpr (std::is_same_v<V, bool>)
+                {
+                    arg.type = ArgType::static_string;
+                    arg.s = value ? "true" : "false";
+                }
+                else if constexpr (std::is_integral_v<V> || std::is_enum_v<V>)
+                {
+                    arg.type = ArgType::integer;
+                    arg.i = static_cast<long long>(value);
+                }
+                else if constexpr (std::is_floating_point_v<V>)
+                {
+                    arg.type = ArgType::floating;
+                    arg.f = static_cast<double>(value);
+                }
+                else if constexpr (std::is_same_v<V, std::string>)
+                {
+                    // One inline copy per event; further strings fall back to a marker
+                    if (event.inline_string[0] == '\0')
+                    {
+                        std::strncpy(event.inline_string, value.c_str(), INLINE_STRING_SIZE - 1);
+                        arg.type = ArgType::inline_string;
+                    }
+                    else
+                    {
+                        arg.type = ArgType::static_string;
+                        arg.s = "<str>";
+                    }
+                }
+                else
+                {
+                    static_assert(std::is_convertible_v<V, const char*>, "Unsupported log argument type");
+                    arg.type = ArgType::static_string;
+                    arg.s = value ? static_cast<const char*>(value) : "(null)";
+                }
+            }
+
+            inline size_t append(char* out, size_t pos, size_t capacity, const char* text)
+            {
+                while (*text && pos + 1 < capacity)
+                    out[pos++] = *text++;
+                return pos;
+            }
+
+            inline size_t append_arg(char* out, size_t pos, size_t capacity, const Event& event, const Arg& arg)
+            {
+                char scratch[32];
+                switch (arg.type)
+                {
+                case ArgType::integer:
+                    std::snprintf(scratch, sizeof(scratch), "%lld", arg.i);
+                    return append(out, pos, capacity, scratch);
+                case ArgType::floating:
+                    std::snprintf(scratch, sizeof(scratch), "%.2f", arg.f);
+                    return append(out, pos, capacity, scratch);
+                case ArgType::static_string:
+                    return append(out, pos, capacity, arg.s);
+                case ArgType::inline_string:
+                    return append(out, pos, capacity, event.inline_string);
+                }
+                return pos;
+            }
+        }
+
+        // =====================================================================
+        // PRODUCER
+        // =====================================================================
+
+        /**
+         * Runtime level check (compile-time ceiling applied by the macros)
+         */
+        inline bool is_enabled(Level level)
+        {
+            return static_cast<int>(level) <= PredictionConfig::get().log_level;
+        }
+
+        /**
+         * Record an event (no formatting, no I/O); drops when the ring is full
+         */
+        template<typename... Args>
+        inline void push(Level level, const char* format, const Args&... args)
+        {
+            static_assert(sizeof...(Args) <= MAX_ARGS, "Too many log arguments");
+
+            detail::Ring& ring = detail::ring();
+            uint32_t write = ring.write_index.load(std::memory_order_relaxed);
+            uint32_t read = ring.read_index.load(std::memory_order_acquire);
+
+            if (write - read >= RING_CAPACITY)
+            {
+                ring.dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            Event& event = ring.events[write & (RING_CAPACITY - 1)];
+            event.time = (g_sdk && g_sdk->clock_facade) ? g_sdk->clock_facade->get_game_time() : 0.f;
+            event.level = level;
+            event.format = format;
+            event.arg_count = 0;
+            event.inline_string[0] = '\0';
+            (detail::encode(event, args), ...);
+
+            ring.write_index.store(write + 1, std::memory_order_release);
+        }
+
+        // =====================================================================
+        // CONSUMER
+        // =====================================================================
+
+        /**
+         * Expand {} placeholders into out (always null terminated)
+         */
+        inline void format_event(const Event& event, char* out, size_t capacity)
+        {
+            static constexpr const char* LEVEL_TAGS[] = { "", "[E] ", "[W] ", "[I] ", "[D] " };
+
+            size_t pos = detail::append(out, 0, capacity, "[Danny.Prediction] ");
+            pos = detail::append(out, pos, capacity, LEVEL_TAGS[static_cast<int>(event.level)]);
+
+            size_t next_arg = 0;
+            for (const char* c = event.format; *c && pos + 1 < capacity; ++c)
+            {
+                if (c[0] == '{' && c[1] == '}')
+                {
+                    if (next_arg < event.arg_count)
+                        pos = detail::append_arg(out, pos, capacity, event, event.args[next_arg++]);
+                    ++c;
+                    continue;
+                }
+                out[pos++] = *c;
+            }
+
+            out[pos] = '\0';
+        }
+
+        /**
+         * Format and print pending events (throttled; call once per game_update)
+         */
+        inline void flush(float current_time, bool force = false)
+        {
+            detail::Ring& ring = detail::ring();
+            const auto& config = PredictionConfig::get();
+
+            if (!force && ring.last_flush_time >= 0.f &&
+                (current_time - ring.last_flush_time) * 1000.f < static_cast<float>(config.log_flush_interval_ms))
+            {
+                return;
+            }
+            ring.last_flush_time = current_time;
+
+            if (!g_sdk)
+                return;
+
+            uint32_t read = ring.read_index.load(std::memory_order_relaxed);
+            uint32_t write = ring.write_index.load(std::memory_order_acquire);
+
+            int max_lines = force ? static_cast<int>(RING_CAPACITY) : config.log_max_lines_per_flush;
+            char line[256];
+
+            for (int printed = 0; read != write && printed < max_lines; ++printed, ++read)
+            {
+                format_event(ring.events[read & (RING_CAPACITY - 1)], line, sizeof(line));
+                g_sdk->log_console("%s", line);
+            }
+
+            ring.read_index.store(read, std::memory_order_release);
+
+            uint32_t dropped = ring.dropped.exchange(0, std::memory_order_relaxed);
+            if (dropped > 0)
+            {
+                std::snprintf(line, sizeof(line), "[Danny.Prediction] %u log events dropped (ring full)", dropped);
+                g_sdk->log_console("%s", line);
+            }
+        }
+
+        /**
+         * Discard pending events
+         */
+        inline void clear()
+        {
+            detail::Ring& ring = detail::ring();
+            ring.read_index.store(ring.write_index.load(std::memory_order_acquire), std::memory_order_release);
+            ring.dropped.store(0, std::memory_order_relaxed);
+            ring.last_flush_time = -1.f;
+        }
+
+    } // namespace Log
+} // namespace HybridPred
+
+// =============================================================================
+// LOGGING MACROS
+// =============================================================================
+
+#define HYBRID_LOG(LEVEL, ...) \
+    do \
+    { \
+        if constexpr (static_cast<int>(LEVEL) <= HYBRID_PRED_LOG_LEVEL) \
+        { \
+            if (::HybridPred::Log::is_enabled(LEVEL)) \
+                ::HybridPred::Log::push(LEVEL, __VA_ARGS__); \
+        } \
+    } while (0)
+
+#define HYBRID_LOG_ERROR(...) HYBRID_LOG(::HybridPred::Log::Level::error, __VA_ARGS__)
+#define HYBRID_LOG_WARN(...)  HYBRID_LOG(::HybridPred::Log::Level::warn, __VA_ARGS__)
+#define HYBRID_LOG_INFO(...)  HYBRID_LOG(::HybridPred::Log::Level::info, __VA_ARGS__)
+#define HYBRID_LOG_DEBUG(...) HYBRID_LOG(::HybridPred::Log::Level::debug, __VA_ARGS__)
@@ -0,0 +1,370 @@
+#pragma once
+
+#include "sdk.hpp"
+#include "PredictionConfig.h"
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// Stage profiler: Set to 1 to time every pipeline stage (infotab line + dump on unload)
+// When 0 the HYBRID_PROFILE_* macros expand to nothing
+#ifndef HYBRID_PRED_ENABLE_PROFILER
+    #define HYBRID_PRED_ENABLE_PROFILER 0
+#endif
+
+/**
+ * =============================================================================
+ * PIPELINE STAGE PROFILER
+ * =============================================================================
+ *
+ * RAII scoped timers around the prediction pipeline stages, recorded into
+ * fixed-size log-linear histograms (4 sub-buckets per power of two, <= 25%
+ * resolution) per stage and per spell type. Reports p50/p95/p99/max and call
+ * counts through the VEN.Infotab overlay and a plain-text dump.
+ *
+ * Stage timers are also mirrored into VEN.Benchmark (benchmark_sdk) entries
+ * when that module is loaded, so the existing benchmark overlay shows them.
+ *
+ * Usage:
+ *   HYBRID_PROFILE_SCOPE(behavior_pdf);
+ *   HYBRID_PROFILE_SPELL_TYPE(spell.spell_type);   // attribute nested stages
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+    namespace Profiler
+    {
+        enum class Stage : uint8_t
+        {
+            tracker_update = 0,
+            edge_cases,
+            reachable_region,
+            behavior_pdf,
+            optimizer,
+            collision,
+            conversion,
+            predict_total,
+            count
+        };
+
+        inline constexpr const char* STAGE_NAMES[] = {
+            "tracker_update", "edge_cases", "reachable_region", "behavior_pdf",
+            "optimizer", "collision", "conversion", "predict_total"
+        };
+        static_assert(sizeof(STAGE_NAMES) / sizeof(STAGE_NAMES[0]) == static_cast<size_t>(Stage::count));
+
+        // Slot 0 aggregates every call; slots 1.. are pred_sdk::spell_type + 1
+        constexpr int SPELL_TYPE_SLOTS = 5;
+        inline constexpr const char* SLOT_NAMES[SPELL_TYPE_SLOTS] = { "all", "linear", "targetted", "circular", "vector" };
+
+        // =====================================================================
+        // HISTOGRAM
+        // =====================================================================
+
+        /**
+         * Log-linear nanosecond histogram
+         * Values < 4 ns map 1:1; above, 4 buckets per power of two (up to ~8.6 s)
+         */
+        struct Histogram
+        {
+            static constexpr int BUCKETS = 128;
+
+            uint32_t buckets[BUCKETS] = {};
+            uint64_t count = 0;
+            uint64_t total_ns = 0;
+            uint64_t max_ns = 0;
+
+            static int bucket_index(uint64_t ns)
+            {
+                if (ns < 4)
+                    return static_cast<int>(ns);
+
+                int exponent = static_cast<int>(std::bit_width(ns)) - 1;
+                int mantissa = static_cast<int>((ns >> (exponent - 2)) & 3);
+                int index = 4 * (exponent - 1) + mantissa;
+                return index < BUCKETS ? index : BUCKETS - 1;
+            }
+
+            static uint64_t bucket_upper_ns(int index)
+            {
+                if (index < 4)
+                    return static_cast<uint64_t>(index + 1);
+
+                int exponent = index / 4 + 1;
+                int mantissa = index % 4;
+                return static_cast<uint64_t>(5 + mantissa) << (exponent - 2);
+            }
+
+            void record(uint64_t ns)
+            {
+                ++buckets[bucket_index(ns)];
+                ++count;
+                total_ns += ns;
+                if (ns > max_ns)
+                    max_ns = ns;
+            }
+
+            // Upper bound of the bucket holding the p-th quantile (p in [0, 1])
+            uint64_t percentile_ns(double p) const
+            {
+                if (count == 0)
+                    return 0;
+
+                uint64_t rank = static_cast<uint64_t>(p * static_cast<double>(count - 1)) + 1;
+                uint64_t seen = 0;
+                for (int i = 0; i < BUCKETS; ++i)
+                {
+                    seen += buckets[i];
+                    if (seen >= rank)
+                    {
+                        uint64_t upper = bucket_upper_ns(i);
+                        return upper < max_ns ? upper : max_ns;
+                    }
+                }
+                return max_ns;
+            }
+        };
+
+#if HYBRID_PRED_ENABLE_PROFILER
+
+        namespace detail
+        {
+            struct State
+            {
+                Histogram stages[static_cast<size_t>(Stage::count)][SPELL_TYPE_SLOTS];
+                benchmark_data* benchmarks[static_cast<size_t>(Stage::count)] = {};
+                uint32_t infotab_id = 0;
+                bool infotab_registered = false;
+            };
+
+            inline State& state()
+            {
+                static State instance;
+                return instance;
+            }
+
+            // Spell type slot for stages nested under HYBRID_PROFILE_SPELL_TYPE (0 = untyped)
+            inline int& current_slot()
+            {
+                thread_local int slot = 0;
+                return slot;
+            }
+
+            inline benchmark_data* benchmark_for(Stage stage)
+            {
+                auto& entry = state().benchmarks[static_cast<size_t>(stage)];
+                if (!entry && sdk::benchmark)
+                    entry = sdk::benchmark->add(std::string("DannyPred::") + STAGE_NAMES[static_cast<size_t>(stage)]);
+                return entry;
+            }
+        }
+
+        // =====================================================================
+        // RECORDING
+        // =====================================================================
+
+        inline void record(Stage stage, uint64_t ns)
+        {
+            auto& row = detail::state().stages[static_cast<size_t>(stage)];
+            row[0].record(ns);
+
+            int slot = detail::current_slot();
+            if (slot > 0)
+                row[slot].record(ns);
+        }
+
+        class ScopedTimer
+        {
+        public:
+            explicit ScopedTimer(Stage stage)
+                : stage_(stage), benchmark_(detail::benchmark_for(stage)),
+                start_(std::chrono::steady_clock::now())
+            {
+                if (benchmark_)
+                    benchmark_->start();
+            }
+
+            ~ScopedTimer()
+            {
+                auto elapsed = std::chrono::steady_clock::now() - start_;
+                if (benchmark_)
+                    benchmark_->stop();
+                record(stage_, static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+            Stage stage_;
+            benchmark_data* benchmark_;
+            std::chrono::steady_clock::time_point start_;
+        };
+
+        class SpellTypeScope
+        {
+        public:
+            explicit SpellTypeScope(pred_sdk::spell_type type)
+                : previous_(detail::current_slot())
+            {
+                int slot = static_cast<int>(type) + 1;
+                detail::current_slot() = (slot > 0 && slot < SPELL_TYPE_SLOTS) ? slot : 0;
+            }
+
+            ~SpellTypeScope() { detail::current_slot() = previous_; }
+
+            SpellTypeScope(const SpellTypeScope&) = delete;
+            SpellTypeScope& operator=(const SpellTypeScope&) = delete;
+
+        private:
+            int previous_;
+        };
+
+        // =====================================================================
+        // REPORTING
+        // =====================================================================
+
+        inline const Histogram& get_histogram(Stage stage, int slot = 0)
+        {
+            return detail::state().stages[static_cast<size_t>(stage)][slot];
+        }
+
+        inline void reset()
+        {
+            auto& state = detail::state();
+            for (auto& row : state.stages)
+                for (auto& histogram : row)
+                    histogram = Histogram{};
+        }
+
+        /**
+         * One-line summary: end-to-end predict percentiles + slowest stage by p99
+         */
+        inline std::string summary_line()
+        {
+            const Histogram& total = get_histogram(Stage::predict_total);
+
+            size_t worst = 0;
+            uint64_t worst_p99 = 0;
+            for (size_t s = 0; s < static_cast<size_t>(Stage::count); ++s)
+            {
+                if (s == static_cast<size_t>(Stage::predict_total))
+                    continue;
+                uint64_t p99 = get_histogram(static_cast<Stage>(s)).percentile_ns(0.99);
+                if (p99 > worst_p99)
+                {
+                    worst_p99 = p99;
+                    worst = s;
+                }
+            }
+
+            char line[192];
+            std::snprintf(line, sizeof(line), "predict p50 %.1fus p99 %.1fus max %.1fus (%llu) | worst p99: %s %.1fus",
+                total.percentile_ns(0.50) / 1000.0, total.percentile_ns(0.99) / 1000.0, total.max_ns / 1000.0,
+                static_cast<unsigned long long>(total.count), STAGE_NAMES[worst], worst_p99 / 1000.0);
+            return line;
+        }
+
+        /**
+         * Write the full stage x spell type table (microseconds)
+         */
+        inline void dump(FILE* file)
+        {
+            std::fprintf(file, "%-18s %-10s %10s %10s %10s %10s %10s %10s\n",
+                "stage", "spell", "calls", "mean_us", "p50_us", "p95_us", "p99_us", "max_us");
+
+            for (size_t s = 0; s < static_cast<size_t>(Stage::count); ++s)
+            {
+                for (int slot = 0; slot < SPELL_TYPE_SLOTS; ++slot)
+                {
+                    const Histogram& h = get_histogram(static_cast<Stage>(s), slot);
+                    if (h.count == 0)
+                        continue;
+
+                    std::fprintf(file, "%-18s %-10s %10llu %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+                        STAGE_NAMES[s], SLOT_NAMES[slot], static_cast<unsigned long long>(h.count),
+                        h.total_ns / 1000.0 / static_cast<double>(h.count),
+                        h.percentile_ns(0.50) / 1000.0, h.percentile_ns(0.95) / 1000.0,
+                        h.percentile_ns(0.99) / 1000.0, h.max_ns / 1000.0);
+                }
+            }
+        }
+
+        inline bool dump_to_file(const char* path)
+        {
+            if (!path || !path[0])
+                return false;
+
+            FILE* file = std::fopen(path, "w");
+            if (!file)
+                return false;
+
+            dump(file);
+            std::fclose(file);
+            return true;
+        }
+
+        /**
+         * Hook benchmark mirroring and the infotab summary line (optional modules)
+         */
+        inline void initialize()
+        {
+            sdk_init::benchmark();
+
+            auto& state = detail::state();
+            if (!state.infotab_registered && sdk_init::infotab() && sdk::infotab)
+            {
+                state.infotab_id = sdk::infotab->add_text(
+                    infotab_sdk::text_entry{ "Danny.Prediction profiler" },
+                    []() { return infotab_sdk::text_entry{ summary_line() }; });
+                state.infotab_registered = true;
+            }
+        }
+
+        /**
+         * Remove the infotab line and dump results (PluginUnload)
+         */
+        inline void shutdown()
+        {
+            auto& state = detail::state();
+            if (state.infotab_registered && sdk::infotab)
+                sdk::infotab->remove_text(state.infotab_id);
+            state.infotab_registered = false;
+
+            dump_to_file(PredictionConfig::get().profiler_dump_path);
+        }
+
+#else
+
+        inline void initialize() {}
+        inline void shutdown() {}
+        inline void reset() {}
+        inline void dump(FILE*) {}
+        inline bool dump_to_file(const char*) { return false; }
+
+#endif // HYBRID_PRED_ENABLE_PROFILER
+
+    } // namespace Profiler
+} // namespace HybridPred
+
+// =============================================================================
+// PROFILING MACROS
+// =============================================================================
+
+#define HYBRID_PROFILE_CONCAT_INNER(a, b) a##b
+#define HYBRID_PROFILE_CONCAT(a, b) HYBRID_PROFILE_CONCAT_INNER(a, b)
+
+#if HYBRID_PRED_ENABLE_PROFILER
+    #define HYBRID_PROFILE_SCOPE(STAGE) \
+        ::HybridPred::Profiler::ScopedTimer HYBRID_PROFILE_CONCAT(hybrid_profile_timer_, __LINE__)(::HybridPred::Profiler::Stage::STAGE)
+    #define HYBRID_PROFILE_SPELL_TYPE(TYPE) \
+        ::HybridPred::Profiler::SpellTypeScope HYBRID_PROFILE_CONCAT(hybrid_profile_type_, __LINE__)(TYPE)
+#else
+    #define HYBRID_PROFILE_SCOPE(STAGE) ((void)0)
+    #define HYBRID_PROFILE_SPELL_TYPE(TYPE) ((void)0)
+#endif
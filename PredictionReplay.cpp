@@ -0,0 +1,407 @@
+// Headless trace replay and offline benchmark driver
+// Not part of the plugin DLL: build as a separate console executable with
+// HYBRID_PRED_BUILD_REPLAY=1 alongside HybridPrediction.cpp, e.g.
+//   DannyPredReplay.exe DannyPred_trace.bin [iterations]
+//   DannyPredReplay.exe DannyPred_telemetry_*.bin  (live outcome summary over sessions)
+// Add HYBRID_PRED_ENABLE_PROFILER=1 for the per-stage latency table.
+#ifndef HYBRID_PRED_BUILD_REPLAY
+    #define HYBRID_PRED_BUILD_REPLAY 0
+#endif
+
+#if HYBRID_PRED_BUILD_REPLAY
+
+#include "HybridPrediction.h"
+#include "PredictionTrace.h"
+#include "PredictionTelemetry.h"
+#include "PredictionProfiler.h"
+#include "ReplaySdk.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace HybridPred;
+
+namespace
+{
+    constexpr int SPELL_TYPE_COUNT = 4;
+    constexpr const char* SPELL_TYPE_NAMES[SPELL_TYPE_COUNT] = { "linear", "targetted", "circular", "vector" };
+
+    struct TimedPosition
+    {
+        float time;
+        math::vector3 position;
+    };
+
+    struct SpellTypeStats
+    {
+        uint64_t predictions = 0;
+        uint64_t valid = 0;
+        uint64_t evaluated = 0;          // Valid predictions with a reconstructable outcome
+        uint64_t hits = 0;
+        double hit_chance_sum = 0.0;     // Over evaluated predictions
+        double live_delta_sum = 0.0;     // |replayed - live| hit chance
+        uint64_t live_compared = 0;
+        uint64_t total_ns = 0;
+    };
+
+    math::vector3 to_vector(const float (&v)[3])
+    {
+        return math::vector3(v[0], v[1], v[2]);
+    }
+
+    /**
+     * Target position at time (linear interpolation between recorded samples)
+     * Returns false outside the recorded span: the outcome is unknown
+     */
+    bool sample_position(const std::vector<TimedPosition>& timeline, float time, math::vector3& out)
+    {
+        if (timeline.empty() || time < timeline.front().time || time > timeline.back().time)
+            return false;
+
+        auto it = std::lower_bound(timeline.begin(), timeline.end(), time,
+            [](const TimedPosition& sample, float t) { return sample.time < t; });
+
+        if (it == timeline.begin())
+        {
+            out = it->position;
+            return true;
+        }
+
+        const TimedPosition& b = *it;
+        const TimedPosition& a = *(it - 1);
+        float span = b.time - a.time;
+        float t = span > 1e-6f ? (time - a.time) / span : 1.f;
+        out = a.position + (b.position - a.position) * t;
+        return true;
+    }
+
+    float distance_to_segment(const math::vector3& point, const math::vector3& start, const math::vector3& end)
+    {
+        float dx = end.x - start.x;
+        float dz = end.z - start.z;
+        float length_sq = dx * dx + dz * dz;
+        float t = length_sq > 1e-6f
+            ? std::clamp(((point.x - start.x) * dx + (point.z - start.z) * dz) / length_sq, 0.f, 1.f)
+            : 0.f;
+
+        float px = start.x + dx * t - point.x;
+        float pz = start.z + dz * t - point.z;
+        return std::sqrt(px * px + pz * pz);
+    }
+
+    /**
+     * Did the recorded target stand inside the spell area when it landed?
+     * Linear: source -> cast segment; circular: disc at cast position.
+     * Returns false when the outcome cannot be judged (other types, trace ended).
+     */
+    bool evaluate_outcome(const Trace::RequestRecord& request, const math::vector3& cast_position,
+        const std::vector<TimedPosition>& timeline, float bounding_radius, bool& hit)
+    {
+        auto type = static_cast<pred_sdk::spell_type>(request.spell_type);
+        if (type != pred_sdk::spell_type::linear && type != pred_sdk::spell_type::circular)
+            return false;
+
+        math::vector3 source_position = to_vector(request.source_position);
+        math::vector3 aim_target;
+        if (!sample_position(timeline, request.time, aim_target))
+            return false;
+
+        float arrival = PhysicsPredictor::compute_arrival_time(source_position,
+            type == pred_sdk::spell_type::circular ? cast_position : aim_target,
+            request.projectile_speed, request.delay);
+
+        math::vector3 landed;
+        if (!sample_position(timeline, request.time + arrival, landed))
+            return false;
+
+        float reach = request.radius + bounding_radius;
+        float miss_distance = type == pred_sdk::spell_type::circular
+            ? landed.distance(cast_position)
+            : distance_to_segment(landed, source_position, cast_position);
+
+        hit = miss_distance <= reach;
+        return true;
+    }
+
+    /**
+     * Live outcome table: casts and hit rate per spell type and hit chance decile
+     */
+    void print_telemetry_summary(const Telemetry::TelemetryData& data)
+    {
+        constexpr int BUCKETS = 10;
+        struct BucketStats
+        {
+            uint64_t predictions = 0;
+            uint64_t casts = 0;
+            uint64_t hits = 0;
+            uint64_t judged = 0;
+            double hit_chance_sum = 0.0;     // Over judged casts
+        };
+        BucketStats table[SPELL_TYPE_COUNT][BUCKETS];
+
+        std::unordered_map<uint32_t, const Telemetry::PredictionRecord*> by_id;
+        for (const auto& prediction : data.predictions)
+        {
+            by_id[prediction.id] = &prediction;
+            if (prediction.spell_type < SPELL_TYPE_COUNT && (prediction.flags & Telemetry::PredictionRecord::VALID))
+            {
+                int bucket = std::clamp(static_cast<int>(prediction.hit_chance * BUCKETS), 0, BUCKETS - 1);
+                ++table[prediction.spell_type][bucket].predictions;
+            }
+        }
+
+        auto bucket_of = [&](uint32_t id) -> BucketStats*
+        {
+            auto found = by_id.find(id);
+            if (found == by_id.end() || found->second->spell_type >= SPELL_TYPE_COUNT)
+                return nullptr;
+            int bucket = std::clamp(static_cast<int>(found->second->hit_chance * BUCKETS), 0, BUCKETS - 1);
+            return &table[found->second->spell_type][bucket];
+        };
+
+        for (const auto& cast : data.casts)
+        {
+            if (BucketStats* bucket = bucket_of(cast.prediction_id))
+                ++bucket->casts;
+        }
+
+        for (const auto& outcome : data.outcomes)
+        {
+            BucketStats* bucket = bucket_of(outcome.prediction_id);
+            if (!bucket || outcome.result == Telemetry::OutcomeRecord::UNKNOWN)
+                continue;
+            ++bucket->judged;
+            bucket->hit_chance_sum += by_id[outcome.prediction_id]->hit_chance;
+            if (outcome.result == Telemetry::OutcomeRecord::HIT)
+                ++bucket->hits;
+        }
+
+        std::printf("telemetry: %d sessions (%zu predictions, %zu casts, %zu outcomes)\n\n", data.sessions,
+            data.predictions.size(), data.casts.size(), data.outcomes.size());
+        std::printf("%-10s %8s %10s %8s %8s %10s %10s\n",
+            "spell", "hc", "predicts", "casts", "judged", "hit_rate", "mean_hc");
+
+        for (int type = 0; type < SPELL_TYPE_COUNT; ++type)
+        {
+            for (int bucket = 0; bucket < BUCKETS; ++bucket)
+            {
+                const BucketStats& s = table[type][bucket];
+                if (s.predictions == 0 && s.casts == 0)
+                    continue;
+
+                std::printf("%-10s %4d-%-3d %10llu %8llu %8llu %10.3f %10.3f\n",
+                    SPELL_TYPE_NAMES[type], bucket * 10, (bucket + 1) * 10,
+                    static_cast<unsigned long long>(s.predictions),
+                    static_cast<unsigned long long>(s.casts),
+                    static_cast<unsigned long long>(s.judged),
+                    s.judged ? static_cast<double>(s.hits) / static_cast<double>(s.judged) : 0.0,
+                    s.judged ? s.hit_chance_sum / static_cast<double>(s.judged) : 0.0);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: %s <trace.bin> [iterations] | <telemetry.bin>...\n", argv[0]);
+        return 1;
+    }
+
+    // Outcome telemetry files (one per session): summarize live hit rates, nothing to replay
+    Telemetry::TelemetryData telemetry;
+    if (Telemetry::load_telemetry(argv[1], telemetry))
+    {
+        for (int i = 2; i < argc; ++i)
+        {
+            if (!Telemetry::load_telemetry(argv[i], telemetry))
+                std::fprintf(stderr, "skipping %s (not a telemetry file)\n", argv[i]);
+        }
+
+        print_telemetry_summary(telemetry);
+        return 0;
+    }
+
+    std::vector<Trace::TraceRecord> records;
+    if (!Trace::load_trace(argv[1], records))
+    {
+        std::fprintf(stderr, "failed to load trace %s\n", argv[1]);
+        return 1;
+    }
+
+    int iterations = argc > 2 ? std::max(1, std::atoi(argv[2])) : 1;
+
+    Replay::ReplayCoreSdk replay_sdk;
+    g_sdk = &replay_sdk;
+
+    auto& config = PredictionConfig::get();
+    config.enable_trace_recording = false;
+    config.enable_outcome_telemetry = false;
+    config.enable_frame_result_cache = false;
+    config.enable_prediction_budget = false;      // Deterministic full-quality pipelines (no frame loop here)
+
+    // Reconstruct per-target timelines up front (outcomes look ahead in time)
+    std::unordered_map<uint32_t, std::vector<TimedPosition>> timelines;
+    std::unordered_map<uint32_t, float> bounding_radii;
+    for (const auto& record : records)
+    {
+        if (record.type != Trace::RecordType::snapshot)
+            continue;
+        timelines[record.snapshot.network_id].push_back(
+            TimedPosition{ record.snapshot.timestamp, to_vector(record.snapshot.position) });
+        bounding_radii[record.snapshot.network_id] = record.snapshot.bounding_radius;
+    }
+
+    SpellTypeStats stats[SPELL_TYPE_COUNT];
+
+    for (int iteration = 0; iteration < iterations; ++iteration)
+    {
+        // Fresh trackers per pass so every iteration replays identical state
+        PredictionManager::clear();
+        Profiler::reset();
+
+        std::unordered_map<uint32_t, std::unique_ptr<Replay::ReplayGameObject>> objects;
+        replay_sdk.objects.heroes.clear();
+        replay_sdk.objects.by_network_id.clear();
+
+        Replay::ReplayGameObject source;
+        bool measure = iteration == iterations - 1;
+
+        for (const auto& record : records)
+        {
+            if (record.type == Trace::RecordType::snapshot)
+            {
+                const auto& snap = record.snapshot;
+                replay_sdk.clock.time = snap.timestamp;
+
+                auto& object = objects[snap.network_id];
+                if (!object)
+                {
+                    object = std::make_unique<Replay::ReplayGameObject>();
+                    object->network_id = snap.network_id;
+                    replay_sdk.objects.heroes.push_back(object.get());
+                    replay_sdk.objects.by_network_id[snap.network_id] = object.get();
+                }
+
+                object->position = to_vector(snap.position);
+                object->hp = snap.hp_percent;
+                object->max_hp = 100.f;
+                object->move_speed = snap.move_speed;
+                object->bounding_radius = snap.bounding_radius;
+                object->is_dashing_ = (snap.flags & Trace::SnapshotRecord::DASHING) != 0;
+
+                MovementSnapshot snapshot;
+                snapshot.position = object->position;
+                snapshot.timestamp = snap.timestamp;
+                snapshot.hp_percent = snap.hp_percent;
+                snapshot.is_auto_attacking = (snap.flags & Trace::SnapshotRecord::AUTO_ATTACKING) != 0;
+                snapshot.is_casting = (snap.flags & Trace::SnapshotRecord::CASTING) != 0;
+                snapshot.is_dashing = object->is_dashing_;
+                snapshot.is_cced = (snap.flags & Trace::SnapshotRecord::CCED) != 0;
+
+                if (auto* tracker = PredictionManager::get_tracker(object.get()))
+                    tracker->ingest_snapshot(snapshot);
+                continue;
+            }
+
+            const auto& request = record.request;
+            auto found = objects.find(request.target_id);
+            if (found == objects.end() || request.spell_type >= SPELL_TYPE_COUNT)
+                continue;
+
+            replay_sdk.clock.time = request.time;
+            replay_sdk.net.ping_ms = request.ping_ms;
+
+            source.network_id = request.source_id;
+            source.position = to_vector(request.source_position);
+
+            pred_sdk::spell_data spell;
+            spell.spell_type = static_cast<pred_sdk::spell_type>(request.spell_type);
+            spell.source = &source;
+            spell.source_position = source.position;
+            spell.spell_slot = -1;         // No slot data in the trace (cone/slot heuristics skipped)
+            spell.range = request.range;
+            spell.radius = request.radius;
+            spell.delay = request.delay;
+            spell.projectile_speed = request.projectile_speed;
+
+            game_object* target = found->second.get();
+            auto* tracker = PredictionManager::get_tracker(target);
+            if (!tracker)
+                continue;
+
+            // One request per replayed tick: nothing from the previous one is live
+            FrameArena::reset();
+
+            auto start = std::chrono::steady_clock::now();
+            HybridPredictionResult result = HybridFusionEngine::compute_hybrid_prediction(&source, target, spell, *tracker);
+            auto elapsed = std::chrono::steady_clock::now() - start;
+
+            if (!measure)
+                continue;
+
+            SpellTypeStats& type_stats = stats[request.spell_type];
+            ++type_stats.predictions;
+            type_stats.total_ns += static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+            if (!result.is_valid)
+                continue;
+            ++type_stats.valid;
+
+            if (request.is_valid)
+            {
+                type_stats.live_delta_sum += std::abs(result.hit_chance - request.hit_chance);
+                ++type_stats.live_compared;
+            }
+
+            bool hit = false;
+            if (evaluate_outcome(request, result.cast_position, timelines[request.target_id],
+                bounding_radii[request.target_id], hit))
+            {
+                ++type_stats.evaluated;
+                type_stats.hit_chance_sum += result.hit_chance;
+                if (hit)
+                    ++type_stats.hits;
+            }
+        }
+    }
+
+    std::printf("trace: %s (%zu records, %d iteration(s))\n\n", argv[1], records.size(), iterations);
+    std::printf("%-10s %10s %10s %12s %10s %10s %10s %12s\n",
+        "spell", "calls", "valid", "ns/predict", "judged", "hit_rate", "mean_hc", "|live_diff|");
+
+    for (int type = 0; type < SPELL_TYPE_COUNT; ++type)
+    {
+        const SpellTypeStats& s = stats[type];
+        if (s.predictions == 0)
+            continue;
+
+        std::printf("%-10s %10llu %10llu %12.0f %10llu %10.3f %10.3f %12.4f\n",
+            SPELL_TYPE_NAMES[type],
+            static_cast<unsigned long long>(s.predictions),
+            static_cast<unsigned long long>(s.valid),
+            static_cast<double>(s.total_ns) / static_cast<double>(s.predictions),
+            static_cast<unsigned long long>(s.evaluated),
+            s.evaluated ? static_cast<double>(s.hits) / static_cast<double>(s.evaluated) : 0.0,
+            s.evaluated ? s.hit_chance_sum / static_cast<double>(s.evaluated) : 0.0,
+            s.live_compared ? s.live_delta_sum / static_cast<double>(s.live_compared) : 0.0);
+    }
+
+#if HYBRID_PRED_ENABLE_PROFILER
+    std::printf("\n");
+    Profiler::dump(stdout);
+#endif
+
+    PredictionManager::clear();
+    g_sdk = nullptr;
+    return 0;
+}
+
+#endif // HYBRID_PRED_BUILD_REPLAY
@@ -0,0 +1,828 @@
+#pragma once
+
+#include "PredictionConfig.h"
+#include <cstdint>
+#include <cmath>
+#include <bit>
+
+/**
+ * =============================================================================
+ * VECTORIZED PREDICTION KERNELS
+ * =============================================================================
+ *
+ * SSE2 / AVX2 implementations of the hot inner loops of the hybrid prediction
+ * system (PDF grid reductions, cell-center and reachability-sample membership
+ * tests), with runtime CPU dispatch and a scalar fallback.
+ *
+ * Every kernel evaluates the exact same arithmetic as the scalar code it
+ * replaces (no FMA contraction, IEEE sqrt/div), so membership decisions are
+ * bit-identical; only the summation order of reductions differs.
+ *
+ * Usage:
+ *   float total = HybridPred::SIMD::sum(&pdf.pdf_grid[0][0], 32 * 32);
+ *
+ * =============================================================================
+ */
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define HYBRID_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#else
+    #define HYBRID_SIMD_X86 0
+#endif
+
+// MSVC emits AVX2 intrinsics without /arch flags; GCC/Clang need a per-function target
+#if HYBRID_SIMD_X86 && !defined(_MSC_VER)
+    #define HYBRID_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define HYBRID_SIMD_TARGET_AVX2
+#endif
+
+namespace HybridPred
+{
+    namespace SIMD
+    {
+        // =====================================================================
+        // KERNEL PARAMETERS
+        // =====================================================================
+
+        enum class Level : uint8_t
+        {
+            scalar = 0,
+            sse2,
+            avx2
+        };
+
+        /**
+         * Capsule in XZ: segment start + seg * t (t in [0,1]) swept by radius
+         * Mirrors HybridFusionEngine::point_in_capsule
+         */
+        struct CapsuleParams
+        {
+            float start_x, start_z;
+            float seg_x, seg_z;
+            float seg_length_sq;
+            float radius_sq;
+        };
+
+        /**
+         * Cone (circular sector) in XZ
+         * Mirrors HybridFusionEngine::point_in_cone
+         */
+        struct ConeParams
+        {
+            float origin_x, origin_z;
+            float dir_x, dir_z;           // Unit axis direction
+            float cos_half_angle;
+            float range_sq;
+        };
+
+        /**
+         * Unit-disk sample set (e.g. Fermat spiral), stored as columns:
+         * sample i = center + (max_radius * radius_scale[i]) * (cos_theta[i], sin_theta[i])
+         */
+        struct DiskSampleTable
+        {
+            const float* radius_scale;
+            const float* cos_theta;
+            const float* sin_theta;
+            int count;
+        };
+
+        /**
+         * Capsule of half-length h and radius w centered on the polar origin
+         * (vector spell lines centered on the target)
+         */
+        struct CenteredLineParams
+        {
+            float half_width;
+            float half_width_sq;          // w^2
+            float half_length_sq;         // h^2
+            float cap_offset;             // h^2 - w^2
+            float two_half_length;        // 2h
+            float reach_sq;               // (h + w)^2
+
+            static CenteredLineParams make(float half_length, float half_width)
+            {
+                float reach = half_length + half_width;
+                return { half_width, half_width * half_width, half_length * half_length,
+                    half_length * half_length - half_width * half_width, 2.f * half_length, reach * reach };
+            }
+        };
+
+        // atan polynomial on [0, 1] (minimax, ~1e-5 rad)
+        inline constexpr float ATAN_C0 = 0.99997726f;
+        inline constexpr float ATAN_C1 = -0.33262347f;
+        inline constexpr float ATAN_C2 = 0.19354346f;
+        inline constexpr float ATAN_C3 = -0.11643287f;
+        inline constexpr float ATAN_C4 = 0.05265332f;
+        inline constexpr float ATAN_C5 = -0.01172120f;
+        inline constexpr float KERNEL_PI = 3.14159265358979323846f;
+        inline constexpr float KERNEL_HALF_PI = KERNEL_PI * 0.5f;
+
+        // =====================================================================
+        // CPU DETECTION
+        // =====================================================================
+
+        inline Level detect_cpu_level()
+        {
+#if HYBRID_SIMD_X86
+            unsigned int regs[4] = {};
+
+    #if defined(_MSC_VER)
+            int info[4] = {};
+            __cpuid(info, 0);
+            int max_leaf = info[0];
+            __cpuid(info, 1);
+            regs[2] = static_cast<unsigned int>(info[2]);
+            regs[3] = static_cast<unsigned int>(info[3]);
+    #else
+            unsigned int max_leaf = __get_cpuid_max(0, nullptr);
+            __get_cpuid(1, &regs[0], &regs[1], &regs[2], &regs[3]);
+    #endif
+
+            bool has_sse2 = (regs[3] & (1u << 26)) != 0;
+            bool has_osxsave = (regs[2] & (1u << 27)) != 0;
+            bool has_avx = (regs[2] & (1u << 28)) != 0;
+
+            bool has_avx2 = false;
+            if (has_osxsave && has_avx && max_leaf >= 7)
+            {
+                // OS must save YMM state (XCR0 bits 1 and 2)
+    #if defined(_MSC_VER)
+                unsigned long long xcr0 = _xgetbv(0);
+                __cpuidex(info, 7, 0);
+                unsigned int ebx7 = static_cast<unsigned int>(info[1]);
+    #else
+                unsigned int xcr0_lo = 0, xcr0_hi = 0;
+                __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+                unsigned long long xcr0 = (static_cast<unsigned long long>(xcr0_hi) << 32) | xcr0_lo;
+                unsigned int eax7 = 0, ebx7 = 0, ecx7 = 0, edx7 = 0;
+                __cpuid_count(7, 0, eax7, ebx7, ecx7, edx7);
+    #endif
+                bool ymm_enabled = (xcr0 & 0x6) == 0x6;
+                has_avx2 = ymm_enabled && (ebx7 & (1u << 5)) != 0;
+            }
+
+            if (has_avx2)
+                return Level::avx2;
+            if (has_sse2)
+                return Level::sse2;
+#endif
+            return Level::scalar;
+        }
+
+        /**
+         * Active kernel level (CPU support, overridable via PredictionConfig)
+         */
+        inline Level get_level()
+        {
+            static const Level cpu_level = detect_cpu_level();
+            return PredictionConfig::get().enable_simd_kernels ? cpu_level : Level::scalar;
+        }
+
+        // =====================================================================
+        // SCALAR REFERENCE KERNELS
+        // =====================================================================
+
+        namespace scalar
+        {
+            inline float sum(const float* data, int count)
+            {
+                float total = 0.f;
+                for (int i = 0; i < count; ++i)
+                    total += data[i];
+                return total;
+            }
+
+            inline void scale(float* data, int count, float factor)
+            {
+                for (int i = 0; i < count; ++i)
+                    data[i] *= factor;
+            }
+
+            inline void add_scaled(float* dst, const float* src, int count, float weight)
+            {
+                for (int i = 0; i < count; ++i)
+                    dst[i] += weight * src[i];
+            }
+
+            inline bool in_capsule(float px, float pz, const CapsuleParams& c)
+            {
+                float tx = px - c.start_x;
+                float tz = pz - c.start_z;
+
+                if (c.seg_length_sq < 1e-6f)
+                    return tx * tx + tz * tz <= c.radius_sq;
+
+                float t = (tx * c.seg_x + tz * c.seg_z) / c.seg_length_sq;
+                t = t < 0.f ? 0.f : (t > 1.f ? 1.f : t);
+
+                float dx = px - (c.start_x + c.seg_x * t);
+                float dz = pz - (c.start_z + c.seg_z * t);
+                return dx * dx + dz * dz <= c.radius_sq;
+            }
+
+            inline bool in_cone(float px, float pz, const ConeParams& c)
+            {
+                float tx = px - c.origin_x;
+                float tz = pz - c.origin_z;
+                float distance_sq = tx * tx + tz * tz;
+
+                if (distance_sq > c.range_sq)
+                    return false;
+
+                float distance = std::sqrt(distance_sq);
+                if (distance < 1e-6f)
+                    return true;
+
+                float cos_angle = (tx * c.dir_x + tz * c.dir_z) / distance;
+                return cos_angle >= c.cos_half_angle;
+            }
+
+            inline int count_disk_samples_in_capsule(const DiskSampleTable& table,
+                float center_x, float center_z, float max_radius, const CapsuleParams& capsule)
+            {
+                int hits = 0;
+                for (int i = 0; i < table.count; ++i)
+                {
+                    float r = max_radius * table.radius_scale[i];
+                    float px = center_x + r * table.cos_theta[i];
+                    float pz = center_z + r * table.sin_theta[i];
+                    if (in_capsule(px, pz, capsule))
+                        ++hits;
+                }
+                return hits;
+            }
+
+            inline int count_disk_samples_in_cone(const DiskSampleTable& table,
+                float center_x, float center_z, float max_radius, const ConeParams& cone)
+            {
+                int hits = 0;
+                for (int i = 0; i < table.count; ++i)
+                {
+                    float r = max_radius * table.radius_scale[i];
+                    float px = center_x + r * table.cos_theta[i];
+                    float pz = center_z + r * table.sin_theta[i];
+                    if (in_cone(px, pz, cone))
+                        ++hits;
+                }
+                return hits;
+            }
+
+            inline float fast_atan2(float y, float x)
+            {
+                float ax = std::abs(x);
+                float ay = std::abs(y);
+                float high = ax > ay ? ax : ay;
+                float low = ax < ay ? ax : ay;
+                if (high < 1e-6f)
+                    return 0.f;
+
+                float t = low / high;
+                float t2 = t * t;
+                float angle = t * (ATAN_C0 + t2 * (ATAN_C1 + t2 * (ATAN_C2 + t2 * (ATAN_C3 + t2 * (ATAN_C4 + t2 * ATAN_C5)))));
+
+                if (ay > ax)
+                    angle = KERNEL_HALF_PI - angle;
+                if (x < 0.f)
+                    angle = KERNEL_PI - angle;
+                return y < 0.f ? -angle : angle;
+            }
+
+            inline void centered_line_arcs(const float* dx, const float* dz, int count,
+                const CenteredLineParams& line, float* phi, float* half_arc)
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    float r_sq = dx[i] * dx[i] + dz[i] * dz[i];
+                    float side_sq = r_sq - line.half_width_sq;
+
+                    float arc;
+                    if (side_sq <= line.half_length_sq)
+                    {
+                        // Leaves through the side: asin(w / r)
+                        arc = fast_atan2(line.half_width, std::sqrt(side_sq > 0.f ? side_sq : 0.f));
+                    }
+                    else
+                    {
+                        // Leaves through the round end cap
+                        float cos_arc = (r_sq + line.cap_offset) / (line.two_half_length * std::sqrt(r_sq));
+                        cos_arc = cos_arc < 1.f ? cos_arc : 1.f;
+                        float sin_sq = 1.f - cos_arc * cos_arc;
+                        arc = fast_atan2(std::sqrt(sin_sq > 0.f ? sin_sq : 0.f), cos_arc);
+                    }
+
+                    if (r_sq > line.reach_sq)
+                        arc = -1.f;
+                    if (r_sq <= line.half_width_sq)
+                        arc = KERNEL_PI;
+
+                    float angle = fast_atan2(dz[i], dx[i]);
+                    phi[i] = angle < 0.f ? angle + KERNEL_PI : angle;
+                    half_arc[i] = arc;
+                }
+            }
+        }
+
+#if HYBRID_SIMD_X86
+        // =====================================================================
+        // SSE2 KERNELS (4 lanes)
+        // =====================================================================
+
+        namespace sse2
+        {
+            inline float horizontal_sum(__m128 v)
+            {
+                __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+                __m128 sums = _mm_add_ps(v, shuf);
+                shuf = _mm_movehl_ps(shuf, sums);
+                sums = _mm_add_ss(sums, shuf);
+                return _mm_cvtss_f32(sums);
+            }
+
+            inline float sum(const float* data, int count)
+            {
+                __m128 acc = _mm_setzero_ps();
+                int i = 0;
+                for (; i + 4 <= count; i += 4)
+                    acc = _mm_add_ps(acc, _mm_loadu_ps(data + i));
+
+                float total = horizontal_sum(acc);
+                for (; i < count; ++i)
+                    total += data[i];
+                return total;
+            }
+
+            inline void scale(float* data, int count, float factor)
+            {
+                __m128 f = _mm_set1_ps(factor);
+                int i = 0;
+                for (; i + 4 <= count; i += 4)
+                    _mm_storeu_ps(data + i, _mm_mul_ps(_mm_loadu_ps(data + i), f));
+                for (; i < count; ++i)
+                    data[i] *= factor;
+            }
+
+            inline void add_scaled(float* dst, const float* src, int count, float weight)
+            {
+                __m128 w = _mm_set1_ps(weight);
+                int i = 0;
+                for (; i + 4 <= count; i += 4)
+                {
+                    __m128 d = _mm_loadu_ps(dst + i);
+                    _mm_storeu_ps(dst + i, _mm_add_ps(d, _mm_mul_ps(w, _mm_loadu_ps(src + i))));
+                }
+                for (; i < count; ++i)
+                    dst[i] += weight * src[i];
+            }
+
+            inline __m128 in_capsule(__m128 px, __m128 pz, const CapsuleParams& c)
+            {
+                __m128 tx = _mm_sub_ps(px, _mm_set1_ps(c.start_x));
+                __m128 tz = _mm_sub_ps(pz, _mm_set1_ps(c.start_z));
+
+                if (c.seg_length_sq < 1e-6f)
+                {
+                    __m128 d2 = _mm_add_ps(_mm_mul_ps(tx, tx), _mm_mul_ps(tz, tz));
+                    return _mm_cmple_ps(d2, _mm_set1_ps(c.radius_sq));
+                }
+
+                __m128 seg_x = _mm_set1_ps(c.seg_x);
+                __m128 seg_z = _mm_set1_ps(c.seg_z);
+                __m128 t = _mm_div_ps(_mm_add_ps(_mm_mul_ps(tx, seg_x), _mm_mul_ps(tz, seg_z)),
+                    _mm_set1_ps(c.seg_length_sq));
+                t = _mm_min_ps(_mm_max_ps(t, _mm_setzero_ps()), _mm_set1_ps(1.f));
+
+                __m128 dx = _mm_sub_ps(px, _mm_add_ps(_mm_set1_ps(c.start_x), _mm_mul_ps(seg_x, t)));
+                __m128 dz = _mm_sub_ps(pz, _mm_add_ps(_mm_set1_ps(c.start_z), _mm_mul_ps(seg_z, t)));
+                __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dz, dz));
+                return _mm_cmple_ps(d2, _mm_set1_ps(c.radius_sq));
+            }
+
+            inline __m128 in_cone(__m128 px, __m128 pz, const ConeParams& c)
+            {
+                __m128 tx = _mm_sub_ps(px, _mm_set1_ps(c.origin_x));
+                __m128 tz = _mm_sub_ps(pz, _mm_set1_ps(c.origin_z));
+                __m128 d2 = _mm_add_ps(_mm_mul_ps(tx, tx), _mm_mul_ps(tz, tz));
+                __m128 in_range = _mm_cmple_ps(d2, _mm_set1_ps(c.range_sq));
+
+                __m128 distance = _mm_sqrt_ps(d2);
+                __m128 at_origin = _mm_cmplt_ps(distance, _mm_set1_ps(1e-6f));
+
+                __m128 dot = _mm_add_ps(_mm_mul_ps(tx, _mm_set1_ps(c.dir_x)), _mm_mul_ps(tz, _mm_set1_ps(c.dir_z)));
+                __m128 in_angle = _mm_cmpge_ps(_mm_div_ps(dot, distance), _mm_set1_ps(c.cos_half_angle));
+
+                return _mm_and_ps(in_range, _mm_or_ps(at_origin, in_angle));
+            }
+
+            inline int count_disk_samples_in_capsule(const DiskSampleTable& table,
+                float center_x, float center_z, float max_radius, const CapsuleParams& capsule)
+            {
+                __m128 cx = _mm_set1_ps(center_x);
+                __m128 cz = _mm_set1_ps(center_z);
+                __m128 radius = _mm_set1_ps(max_radius);
+
+                int hits = 0;
+                int i = 0;
+                for (; i + 4 <= table.count; i += 4)
+                {
+                    __m128 r = _mm_mul_ps(radius, _mm_loadu_ps(table.radius_scale + i));
+                    __m128 px = _mm_add_ps(cx, _mm_mul_ps(r, _mm_loadu_ps(table.cos_theta + i)));
+                    __m128 pz = _mm_add_ps(cz, _mm_mul_ps(r, _mm_loadu_ps(table.sin_theta + i)));
+                    hits += std::popcount(static_cast<unsigned int>(_mm_movemask_ps(in_capsule(px, pz, capsule))));
+                }
+
+                DiskSampleTable tail{ table.radius_scale + i, table.cos_theta + i, table.sin_theta + i, table.count - i };
+                return hits + scalar::count_disk_samples_in_capsule(tail, center_x, center_z, max_radius, capsule);
+            }
+
+            inline int count_disk_samples_in_cone(const DiskSampleTable& table,
+                float center_x, float center_z, float max_radius, const ConeParams& cone)
+            {
+                __m128 cx = _mm_set1_ps(center_x);
+                __m128 cz = _mm_set1_ps(center_z);
+                __m128 radius = _mm_set1_ps(max_radius);
+
+                int hits = 0;
+                int i = 0;
+                for (; i + 4 <= table.count; i += 4)
+                {
+                    __m128 r = _mm_mul_ps(radius, _mm_loadu_ps(table.radius_scale + i));
+                    __m128 px = _mm_add_ps(cx, _mm_mul_ps(r, _mm_loadu_ps(table.cos_theta + i)));
+                    __m128 pz = _mm_add_ps(cz, _mm_mul_ps(r, _mm_loadu_ps(table.sin_theta + i)));
+                    hits += std::popcount(static_cast<unsigned int>(_mm_movemask_ps(in_cone(px, pz, cone))));
+                }
+
+                DiskSampleTable tail{ table.radius_scale + i, table.cos_theta + i, table.sin_theta + i, table.count - i };
+                return hits + scalar::count_disk_samples_in_cone(tail, center_x, center_z, max_radius, cone);
+            }
+
+            inline __m128 select(__m128 mask, __m128 if_true, __m128 if_false)
+            {
+                return _mm_or_ps(_mm_and_ps(mask, if_true), _mm_andnot_ps(mask, if_false));
+            }
+
+            inline __m128 fast_atan2(__m128 y, __m128 x)
+            {
+                __m128 sign = _mm_set1_ps(-0.f);
+                __m128 ax = _mm_andnot_ps(sign, x);
+                __m128 ay = _mm_andnot_ps(sign, y);
+                __m128 high = _mm_max_ps(ax, ay);
+                __m128 low = _mm_min_ps(ax, ay);
+
+                __m128 t = _mm_div_ps(low, high);
+                __m128 t2 = _mm_mul_ps(t, t);
+                __m128 poly = _mm_add_ps(_mm_set1_ps(ATAN_C4), _mm_mul_ps(t2, _mm_set1_ps(ATAN_C5)));
+                poly = _mm_add_ps(_mm_set1_ps(ATAN_C3), _mm_mul_ps(t2, poly));
+                poly = _mm_add_ps(_mm_set1_ps(ATAN_C2), _mm_mul_ps(t2, poly));
+                poly = _mm_add_ps(_mm_set1_ps(ATAN_C1), _mm_mul_ps(t2, poly));
+                poly = _mm_add_ps(_mm_set1_ps(ATAN_C0), _mm_mul_ps(t2, poly));
+                __m128 angle = _mm_mul_ps(t, poly);
+
+                angle = select(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(KERNEL_HALF_PI), angle), angle);
+                angle = select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(KERNEL_PI), angle), angle);
+                angle = select(_mm_cmplt_ps(y, _mm_setzero_ps()), _mm_sub_ps(_mm_setzero_ps(), angle), angle);
+                return _mm_andnot_ps(_mm_cmplt_ps(high, _mm_set1_ps(1e-6f)), angle);
+            }
+
+            inline void centered_line_arcs(const float* dx, const float* dz, int count,
+                const CenteredLineParams& line, float* phi, float* half_arc)
+            {
+                __m128 zero = _mm_setzero_ps();
+                __m128 one = _mm_set1_ps(1.f);
+                __m128 width = _mm_set1_ps(line.half_width);
+                __m128 width_sq = _mm_set1_ps(line.half_width_sq);
+
+                int i = 0;
+                for (; i + 4 <= count; i += 4)
+                {
+                    __m128 px = _mm_loadu_ps(dx + i);
+                    __m128 pz = _mm_loadu_ps(dz + i);
+                    __m128 r_sq = _mm_add_ps(_mm_mul_ps(px, px), _mm_mul_ps(pz, pz));
+                    __m128 side_sq = _mm_sub_ps(r_sq, width_sq);
+
+                    // Side exit: atan2(w, sqrt(r^2 - w^2)); cap exit: atan2(sin, cos)
+                    __m128 cos_arc = _mm_div_ps(_mm_add_ps(r_sq, _mm_set1_ps(line.cap_offset)),
+                        _mm_mul_ps(_mm_set1_ps(line.two_half_length), _mm_sqrt_ps(r_sq)));
+                    cos_arc = _mm_min_ps(cos_arc, one);
+                    __m128 sin_arc = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(one, _mm_mul_ps(cos_arc, cos_arc)), zero));
+
+                    __m128 side = _mm_cmple_ps(side_sq, _mm_set1_ps(line.half_length_sq));
+                    __m128 arc = fast_atan2(select(side, width, sin_arc),
+                        select(side, _mm_sqrt_ps(_mm_max_ps(side_sq, zero)), cos_arc));
+
+                    arc = select(_mm_cmpgt_ps(r_sq, _mm_set1_ps(line.reach_sq)), _mm_set1_ps(-1.f), arc);
+                    arc = select(_mm_cmple_ps(r_sq, width_sq), _mm_set1_ps(KERNEL_PI), arc);
+
+                    __m128 angle = fast_atan2(pz, px);
+                    angle = _mm_add_ps(angle, _mm_and_ps(_mm_cmplt_ps(angle, zero), _mm_set1_ps(KERNEL_PI)));
+
+                    _mm_storeu_ps(phi + i, angle);
+                    _mm_storeu_ps(half_arc + i, arc);
+                }
+
+                scalar::centered_line_arcs(dx + i, dz + i, count - i, line, phi + i, half_arc + i);
+            }
+        }
+
+        // =====================================================================
+        // AVX2 KERNELS (8 lanes)
+        // =====================================================================
+
+        namespace avx2
+        {
+            HYBRID_SIMD_TARGET_AVX2 inline float horizontal_sum(__m256 v)
+            {
+                __m128 lo = _mm256_castps256_ps128(v);
+                __m128 hi = _mm256_extractf128_ps(v, 1);
+                return sse2::horizontal_sum(_mm_add_ps(lo, hi));
+            }
+
+            HYBRID_SIMD_TARGET_AVX2 inline float sum(const float* data, int count)
+            {
+                __m256 acc = _mm256_setzero_ps();
+                int i = 0;
+                for (; i + 8 <= count; i += 8)
+                    acc = _mm256_add_ps(acc, _mm256_loadu_ps(data + i));
+
+                float total = horizontal_sum(acc);
+                for (; i < count; ++i)
+                    total += data[i];
+                return total;
+            }
+
+            HYBRID_SIMD_TARGET_AVX2 inline void scale(float* data, int count, float factor)
+            {
+                __m256 f = _mm256_set1_ps(factor);
+                int i = 0;
+                for (; i + 8 <= count; i += 8)
+                    _mm256_storeu_ps(data + i, _mm256_mul_ps(_mm256_loadu_ps(data + i), f));
+                for (; i < count; ++i)
+                    data[i] *= factor;
+            }
+
+            HYBRID_SIMD_TARGET_AVX2 inline __m256 in_capsule(__m256 px, __m256 pz, const CapsuleParams& c)
+            {
+                __m256 tx = _mm256_sub_ps(px, _mm256_set1_ps(c.start_x));
+                __m256 tz = _mm256_sub_ps(pz, _mm256_set1_ps(c.start_z));
+
+                if (c.seg_length_sq < 1e-6f)
+                {
+                    __m256 d2 = _mm256_add_ps(_mm256_mul_ps(tx, tx), _mm256_mul_ps(tz, tz));
+                    return _mm256_cmp_ps(d2, _mm256_set1_ps(c.radius_sq), _CMP_LE_OQ);
+                }
+
+                __m256 seg_x = _mm256_set1_ps(c.seg_x);
+                __m256 seg_z = _mm256_set1_ps(c.seg_z);
+                __m256 t = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(tx, seg_x), _mm256_mul_ps(tz, seg_z)),
+                    _mm256_set1_ps(c.seg_length_sq));
+                t = _mm256_min_ps(_mm256_max_ps(t, _mm256_setzero_ps()), _mm256_set1_ps(1.f));
+
+                __m256 dx = _mm256_sub_ps(px, _mm256_add_ps(_mm256_set1_ps(c.start_x), _mm256_mul_ps(seg_x, t)));
+                __m256 dz = _mm256_sub_ps(pz, _mm256_add_ps(_mm256_set1_ps(c.start_z), _mm256_mul_ps(seg_z, t)));
+                __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dz, dz));
+                return _mm256_cmp_ps(d2, _mm256_set1_ps(c.radius_sq), _CMP_LE_OQ);
+            }
+
+            HYBRID_SIMD_TARGET_AVX2 inline __m256 in_cone(__m256 px, __m256 pz, const ConeParams& c)
+            {
+                __m256 tx = _mm256_sub_ps(px, _mm256_set1_ps(c.origin_x));
+                __m256 tz = _mm256_sub_ps(pz, _mm256_set1_ps(c.origin_z));
+                __m256 d2 = _mm256_add_ps(_mm256_mul_ps(tx, tx), _mm256_mul_ps(tz, tz));
+                __m256 in_range = _mm256_cmp_ps(d2, _mm256_set1_ps(c.range_sq), _CMP_LE_OQ);
+
+                __m256 distance = _mm256_sqrt_ps(d2);
+                __m256 at_origin = _mm256_cmp_ps(distance, _mm256_set1_ps(1e-6f), _CMP_LT_OQ);
+
+                __m256 dot = _mm256_add_ps(_mm256_mul_ps(tx, _mm256_set1_ps(c.dir_x)),
+                    _mm256_mul_ps(tz, _mm256_set1_ps(c.dir_z)));
+                __m256 in_angle = _mm256_cmp_ps(_mm256_div_ps(dot, distance),
+                    _mm256_set1_ps(c.cos_half_angle), _CMP_GE_OQ);
+
+                return _mm256_and_ps(in_range, _mm256_or_ps(at_origin, in_angle));
+            }
+
+            HYBRID_SIMD_TARGET_AVX2 inline int count_disk_samples_in_capsule(const DiskSampleTable& table,
+                float center_x, float center_z, float max_radius, const CapsuleParams& capsule)
+            {
+                __m256 cx = _mm256_set1_ps(center_x);
+                __m256 cz = _mm256_set1_ps(center_z);
+                __m256 radius = _mm256_set1_ps(max_radius);
+
+                int hits = 0;
+                int i = 0;
+                for (; i + 8 <= table.count; i += 8)
+                {
+                    __m256 r = _mm256_mul_ps(radius, _mm256_loadu_ps(table.radius_scale + i));
+                    __m256 px = _mm256_add_ps(cx, _mm256_mul_ps(r, _mm256_loadu_ps(table.cos_theta + i)));
+                    __m256 pz = _mm256_add_ps(cz, _mm256_mul_ps(r, _mm256_loadu_ps(table.sin_theta + i)));
+                    hits += std::popcount(static_cast<unsigned int>(_mm256_movemask_ps(in_capsule(px, pz, capsule))));
+                }
+
+                DiskSampleTable tail{ table.radius_scale + i, table.cos_theta + i, table.sin_theta + i, table.count - i };
+                return hits + scalar::count_disk_samples_in_capsule(tail, center_x, center_z, max_radius, capsule);
+            }
+
+            HYBRID_SIMD_TARGET_AVX2 inline int count_disk_samples_in_cone(const DiskSampleTable& table,
+                float center_x, float center_z, float max_radius, const ConeParams& cone)
+            {
+                __m256 cx = _mm256_set1_ps(center_x);
+                __m256 cz = _mm256_set1_ps(center_z);
+                __m256 radius = _mm256_set1_ps(max_radius);
+
+                int hits = 0;
+                int i = 0;
+                for (; i + 8 <= table.count; i += 8)
+                {
+                    __m256 r = _mm256_mul_ps(radius, _mm256_loadu_ps(table.radius_scale + i));
+                    __m256 px = _mm256_add_ps(cx, _mm256_mul_ps(r, _mm256_loadu_ps(table.cos_theta + i)));
+                    __m256 pz = _mm256_add_ps(cz, _mm256_mul_ps(r, _mm256_loadu_ps(table.sin_theta + i)));
+                    hits += std::popcount(static_cast<unsigned int>(_mm256_movemask_ps(in_cone(px, pz, cone))));
+                }
+
+                DiskSampleTable tail{ table.radius_scale + i, table.cos_theta + i, table.sin_theta + i, table.count - i };
+                return hits + scalar::count_disk_samples_in_cone(tail, center_x, center_z, max_radius, cone);
+            }
+
+            HYBRID_SIMD_TARGET_AVX2 inline __m256 fast_atan2(__m256 y, __m256 x)
+            {
+                __m256 sign = _mm256_set1_ps(-0.f);
+                __m256 ax = _mm256_andnot_ps(sign, x);
+                __m256 ay = _mm256_andnot_ps(sign, y);
+                __m256 high = _mm256_max_ps(ax, ay);
+                __m256 low = _mm256_min_ps(ax, ay);
+
+                __m256 t = _mm256_div_ps(low, high);
+                __m256 t2 = _mm256_mul_ps(t, t);
+                __m256 poly = _mm256_add_ps(_mm256_set1_ps(ATAN_C4), _mm256_mul_ps(t2, _mm256_set1_ps(ATAN_C5)));
+                poly = _mm256_add_ps(_mm256_set1_ps(ATAN_C3), _mm256_mul_ps(t2, poly));
+                poly = _mm256_add_ps(_mm256_set1_ps(ATAN_C2), _mm256_mul_ps(t2, poly));
+                poly = _mm256_add_ps(_mm256_set1_ps(ATAN_C1), _mm256_mul_ps(t2, poly));
+                poly = _mm256_add_ps(_mm256_set1_ps(ATAN_C0), _mm256_mul_ps(t2, poly));
+                __m256 angle = _mm256_mul_ps(t, poly);
+
+                angle = _mm256_blendv_ps(angle, _mm256_sub_ps(_mm256_set1_ps(KERNEL_HALF_PI), angle),
+                    _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+                angle = _mm256_blendv_ps(angle, _mm256_sub_ps(_mm256_set1_ps(KERNEL_PI), angle),
+                    _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+                angle = _mm256_blendv_ps(angle, _mm256_sub_ps(_mm256_setzero_ps(), angle),
+                    _mm256_cmp_ps(y, _mm256_setzero_ps(), _CMP_LT_OQ));
+                return _mm256_andnot_ps(_mm256_cmp_ps(high, _mm256_set1_ps(1e-6f), _CMP_LT_OQ), angle);
+            }
+
+            HYBRID_SIMD_TARGET_AVX2 inline void centered_line_arcs(const float* dx, const float* dz, int count,
+                const CenteredLineParams& line, float* phi, float* half_arc)
+            {
+                __m256 zero = _mm256_setzero_ps();
+                __m256 one = _mm256_set1_ps(1.f);
+                __m256 width = _mm256_set1_ps(line.half_width);
+                __m256 width_sq = _mm256_set1_ps(line.half_width_sq);
+
+                int i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m256 px = _mm256_loadu_ps(dx + i);
+                    __m256 pz = _mm256_loadu_ps(dz + i);
+                    __m256 r_sq = _mm256_add_ps(_mm256_mul_ps(px, px), _mm256_mul_ps(pz, pz));
+                    __m256 side_sq = _mm256_sub_ps(r_sq, width_sq);
+
+                    // Side exit: atan2(w, sqrt(r^2 - w^2)); cap exit: atan2(sin, cos)
+                    __m256 cos_arc = _mm256_div_ps(_mm256_add_ps(r_sq, _mm256_set1_ps(line.cap_offset)),
+                        _mm256_mul_ps(_mm256_set1_ps(line.two_half_length), _mm256_sqrt_ps(r_sq)));
+                    cos_arc = _mm256_min_ps(cos_arc, one);
+                    __m256 sin_arc = _mm256_sqrt_ps(_mm256_max_ps(_mm256_sub_ps(one, _mm256_mul_ps(cos_arc, cos_arc)), zero));
+
+                    __m256 side = _mm256_cmp_ps(side_sq, _mm256_set1_ps(line.half_length_sq), _CMP_LE_OQ);
+                    __m256 arc = fast_atan2(_mm256_blendv_ps(sin_arc, width, side),
+                        _mm256_blendv_ps(cos_arc, _mm256_sqrt_ps(_mm256_max_ps(side_sq, zero)), side));
+
+                    arc = _mm256_blendv_ps(arc, _mm256_set1_ps(-1.f),
+                        _mm256_cmp_ps(r_sq, _mm256_set1_ps(line.reach_sq), _CMP_GT_OQ));
+                    arc = _mm256_blendv_ps(arc, _mm256_set1_ps(KERNEL_PI), _mm256_cmp_ps(r_sq, width_sq, _CMP_LE_OQ));
+
+                    __m256 angle = fast_atan2(pz, px);
+                    angle = _mm256_add_ps(angle, _mm256_and_ps(_mm256_cmp_ps(angle, zero, _CMP_LT_OQ),
+                        _mm256_set1_ps(KERNEL_PI)));
+
+                    _mm256_storeu_ps(phi + i, angle);
+                    _mm256_storeu_ps(half_arc + i, arc);
+                }
+
+                scalar::centered_line_arcs(dx + i, dz + i, count - i, line, phi + i, half_arc + i);
+            }
+        }
+#endif
+
+        // =====================================================================
+        // DISPATCHED ENTRY POINTS
+        // =====================================================================
+
+        /**
+         * Sum of count floats
+         */
+        inline float sum(const float* data, int count)
+        {
+#if HYBRID_SIMD_X86
+            switch (get_level())
+            {
+            case Level::avx2: return avx2::sum(data, count);
+            case Level::sse2: return sse2::sum(data, count);
+            default: break;
+            }
+#endif
+            return scalar::sum(data, count);
+        }
+
+        /**
+         * data[i] *= factor
+         */
+        inline void scale(float* data, int count, float factor)
+        {
+#if HYBRID_SIMD_X86
+            switch (get_level())
+            {
+            case Level::avx2: avx2::scale(data, count, factor); return;
+            case Level::sse2: sse2::scale(data, count, factor); return;
+            default: break;
+            }
+#endif
+            scalar::scale(data, count, factor);
+        }
+
+        /**
+         * dst[i] += weight * src[i] (short rows - SSE at most)
+         */
+        inline void add_scaled(float* dst, const float* src, int count, float weight)
+        {
+#if HYBRID_SIMD_X86
+            if (get_level() != Level::scalar)
+            {
+                sse2::add_scaled(dst, src, count, weight);
+                return;
+            }
+#endif
+            scalar::add_scaled(dst, src, count, weight);
+        }
+
+        /**
+         * Number of disk samples (scaled by max_radius around center) inside capsule
+         */
+        inline int count_disk_samples_in_capsule(const DiskSampleTable& table,
+            float center_x, float center_z, float max_radius, const CapsuleParams& capsule)
+        {
+#if HYBRID_SIMD_X86
+            switch (get_level())
+            {
+            case Level::avx2: return avx2::count_disk_samples_in_capsule(table, center_x, center_z, max_radius, capsule);
+            case Level::sse2: return sse2::count_disk_samples_in_capsule(table, center_x, center_z, max_radius, capsule);
+            default: break;
+            }
+#endif
+            return scalar::count_disk_samples_in_capsule(table, center_x, center_z, max_radius, capsule);
+        }
+
+        /**
+         * Number of disk samples (scaled by max_radius around center) inside cone
+         */
+        inline int count_disk_samples_in_cone(const DiskSampleTable& table,
+            float center_x, float center_z, float max_radius, const ConeParams& cone)
+        {
+#if HYBRID_SIMD_X86
+            switch (get_level())
+            {
+            case Level::avx2: return avx2::count_disk_samples_in_cone(table, center_x, center_z, max_radius, cone);
+            case Level::sse2: return sse2::count_disk_samples_in_cone(table, center_x, center_z, max_radius, cone);
+            default: break;
+            }
+#endif
+            return scalar::count_disk_samples_in_cone(table, center_x, center_z, max_radius, cone);
+        }
+
+        /**
+         * Orientation arc of each point (dx, dz) inside a line centered on the origin
+         * The line at angle theta contains the point iff |theta - phi| <= half_arc
+         * (mod pi). phi in [0, pi]; half_arc < 0: never inside, >= pi: always inside.
+         * Uses a polynomial atan2 (~1e-5 rad), identical across levels.
+         */
+        inline void centered_line_arcs(const float* dx, const float* dz, int count,
+            const CenteredLineParams& line, float* phi, float* half_arc)
+        {
+#if HYBRID_SIMD_X86
+            switch (get_level())
+            {
+            case Level::avx2: avx2::centered_line_arcs(dx, dz, count, line, phi, half_arc); return;
+            case Level::sse2: sse2::centered_line_arcs(dx, dz, count, line, phi, half_arc); return;
+            default: break;
+            }
+#endif
+            scalar::centered_line_arcs(dx, dz, count, line, phi, half_arc);
+        }
+
+    } // namespace SIMD
+} // namespace HybridPred
@@ -0,0 +1,219 @@
+#pragma once
+
+/**
+ * =============================================================================
+ * PRECOMPUTED SAMPLE TABLES
+ * =============================================================================
+ *
+ * Compile-time unit-disk, unit-circle and Gaussian kernel tables for the
+ * hybrid prediction hot paths. Call sites only scale and translate the stored
+ * values instead of evaluating sqrt/cos/sin/exp on every call.
+ *
+ * All tables are evaluated in double precision by constexpr helpers and
+ * rounded to float once, so they are at least as accurate as the runtime
+ * float std:: calls they replace.
+ *
+ * Usage:
+ *   const auto& circle = Tables::BOUNDARY_CIRCLE;
+ *   point.x = center.x + radius * circle.cos_theta[i];
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+    namespace Tables
+    {
+        // =====================================================================
+        // CONSTEXPR MATH (double precision, compile time only)
+        // =====================================================================
+
+        namespace detail
+        {
+            constexpr double PI_D = 3.14159265358979323846;
+
+            // Reduce to [-PI, PI] so the Taylor series converges quickly
+            constexpr double wrap_angle(double x)
+            {
+                constexpr double TWO_PI = 2.0 * PI_D;
+                long long turns = static_cast<long long>(x / TWO_PI);
+                x -= static_cast<double>(turns) * TWO_PI;
+                if (x > PI_D) x -= TWO_PI;
+                if (x < -PI_D) x += TWO_PI;
+                return x;
+            }
+
+            constexpr double sin(double x)
+            {
+                x = wrap_angle(x);
+                double term = x;
+                double result = x;
+                for (int n = 1; n < 20; ++n)
+                {
+                    term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+                    result += term;
+                }
+                return result;
+            }
+
+            constexpr double cos(double x)
+            {
+                x = wrap_angle(x);
+                double term = 1.0;
+                double result = 1.0;
+                for (int n = 1; n < 20; ++n)
+                {
+                    term *= -x * x / ((2.0 * n - 1.0) * (2.0 * n));
+                    result += term;
+                }
+                return result;
+            }
+
+            constexpr double sqrt(double x)
+            {
+                if (x <= 0.0)
+                    return 0.0;
+
+                // Newton-Raphson (quadratic convergence from any positive guess)
+                double guess = x > 1.0 ? x : 1.0;
+                for (int i = 0; i < 64; ++i)
+                {
+                    double next = 0.5 * (guess + x / guess);
+                    if (next == guess)
+                        break;
+                    guess = next;
+                }
+                return guess;
+            }
+
+            constexpr double exp(double x)
+            {
+                // exp(x) = exp(x / 2^k)^(2^k), series on the reduced argument
+                int halvings = 0;
+                while (x > 0.5 || x < -0.5)
+                {
+                    x *= 0.5;
+                    ++halvings;
+                }
+
+                double term = 1.0;
+                double result = 1.0;
+                for (int n = 1; n < 20; ++n)
+                {
+                    term *= x / n;
+                    result += term;
+                }
+
+                for (int i = 0; i < halvings; ++i)
+                    result *= result;
+                return result;
+            }
+        }
+
+        // =====================================================================
+        // TABLE TYPES
+        // =====================================================================
+
+        /**
+         * Unit-disk Fermat spiral (SoA columns)
+         * Sample i: radius sqrt(i/N), angle 2*PI*i/N * SPIRAL_FACTOR
+         * SPIRAL_FACTOR must be coprime with N for uniform angular coverage
+         */
+        template<int N, int SPIRAL_FACTOR>
+        struct FermatSpiral
+        {
+            static constexpr int SAMPLES = N;
+
+            alignas(32) float radius_scale[N] = {};
+            alignas(32) float cos_theta[N] = {};
+            alignas(32) float sin_theta[N] = {};
+
+            constexpr FermatSpiral()
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    double theta = (2.0 * detail::PI_D * i) / N * SPIRAL_FACTOR;
+                    radius_scale[i] = static_cast<float>(detail::sqrt(static_cast<double>(i) / N));
+                    cos_theta[i] = static_cast<float>(detail::cos(theta));
+                    sin_theta[i] = static_cast<float>(detail::sin(theta));
+                }
+            }
+        };
+
+        /**
+         * N evenly spaced unit directions: angle 2*PI*i/N
+         */
+        template<int N>
+        struct UnitCircle
+        {
+            static constexpr int SAMPLES = N;
+
+            float cos_theta[N] = {};
+            float sin_theta[N] = {};
+
+            constexpr UnitCircle()
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    double theta = (2.0 * detail::PI_D * i) / N;
+                    cos_theta[i] = static_cast<float>(detail::cos(theta));
+                    sin_theta[i] = static_cast<float>(detail::sin(theta));
+                }
+            }
+        };
+
+        /**
+         * Unnormalized 2D Gaussian splat weights: exp(-(i² + j²) / (2σ²))
+         * weights[i + RADIUS][j + RADIUS] for i, j in [-RADIUS, RADIUS]
+         */
+        template<int RADIUS>
+        struct GaussianKernel
+        {
+            static constexpr int WIDTH = 2 * RADIUS + 1;
+
+            float weights[WIDTH][WIDTH] = {};
+
+            constexpr GaussianKernel(double sigma)
+            {
+                for (int i = -RADIUS; i <= RADIUS; ++i)
+                {
+                    for (int j = -RADIUS; j <= RADIUS; ++j)
+                    {
+                        double dist_sq = static_cast<double>(i * i + j * j);
+                        weights[i + RADIUS][j + RADIUS] =
+                            static_cast<float>(detail::exp(-dist_sq / (2.0 * sigma * sigma)));
+                    }
+                }
+            }
+        };
+
+        // =====================================================================
+        // TABLE INSTANCES
+        // =====================================================================
+
+        // Reachability overlap integration (capsule / cone): 128 samples, 7 coprime with 128
+        inline constexpr FermatSpiral<128, 7> REACHABILITY_SPIRAL{};
+
+        // PhysicsPredictor::compute_reachable_region boundary discretization
+        inline constexpr UnitCircle<32> BOUNDARY_CIRCLE{};
+
+        // find_optimal_cast_position gradient ascent probe directions
+        inline constexpr UnitCircle<8> GRADIENT_DIRECTIONS{};
+
+        // optimize_vector_orientation candidate line orientations
+        inline constexpr UnitCircle<20> VECTOR_ORIENTATIONS{};
+
+        // Reduced / minimal quality tier variants (TierParams in HybridPrediction.cpp)
+        inline constexpr FermatSpiral<64, 7> REACHABILITY_SPIRAL_REDUCED{};
+        inline constexpr FermatSpiral<32, 7> REACHABILITY_SPIRAL_MINIMAL{};
+        inline constexpr UnitCircle<24> BOUNDARY_CIRCLE_REDUCED{};
+        inline constexpr UnitCircle<16> BOUNDARY_CIRCLE_MINIMAL{};
+        inline constexpr UnitCircle<4> GRADIENT_DIRECTIONS_MINIMAL{};
+        inline constexpr UnitCircle<12> VECTOR_ORIENTATIONS_REDUCED{};
+        inline constexpr UnitCircle<10> VECTOR_ORIENTATIONS_MINIMAL{};
+
+        // BehaviorPDF::add_weighted_sample splat (σ = 1.5 cells, radius 2)
+        inline constexpr GaussianKernel<2> PDF_SPLAT_KERNEL{ 1.5 };
+
+    } // namespace Tables
+} // namespace HybridPred
@@ -0,0 +1,498 @@
+#pragma once
+
+#include "sdk.hpp"
+#include "PredictionConfig.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+/**
+ * =============================================================================
+ * OUTCOME TELEMETRY
+ * =============================================================================
+ *
+ * Always-on record of what the prediction said and what happened, for hit
+ * rates per spell type / hit chance bucket (PredictionReplay.cpp reads it).
+ *
+ * Three fixed-size POD record kinds:
+ *   prediction  every computed prediction (result, pattern state, opportunity)
+ *   cast        the local player cast a slot shortly after predicting it
+ *   outcome     that cast resolved at arrival time: hit / miss / unknown
+ *
+ * The game thread only copies records into a lock-free single-producer ring
+ * (no locks, no allocation, tens of nanoseconds per prediction); a writer
+ * thread, woken once per game_update, drains it into per-kind column blocks.
+ * A full ring drops records (Stats::dropped) instead of waiting.
+ *
+ * File layout (little-endian, version 1):
+ *   FileHeader, then blocks of { BlockHeader, one array per column }.
+ *   Columns follow the record's field order (PREDICTION_COLUMNS, ...), so a
+ *   reader can load just the fields it needs.
+ *
+ * Every session (plugin load) writes its own file, telemetry_path with the
+ * start time inserted before the extension (DannyPred_telemetry_<unix>.bin),
+ * so earlier games are never truncated. load_telemetry appends into one
+ * TelemetryData, so any number of session files can be summarized together.
+ *
+ * Cast matching: process_cast from the local player on a slot matches the
+ * last prediction for that slot from the same source within CAST_MATCH_WINDOW.
+ * The outcome is judged like the replay harness: target inside the spell
+ * radius (+ bounding radius) at cast time + arrival time.
+ *
+ * The writer must be joined before the module unloads: PluginUnload ->
+ * PredictionManager::clear -> Recorder::shutdown. Static destruction only
+ * checks that it was.
+ *
+ * Enable with PredictionConfig::enable_outcome_telemetry (telemetry_path).
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+    struct HybridPredictionResult;
+    struct DodgePattern;
+
+    namespace Telemetry
+    {
+        constexpr uint32_t FILE_MAGIC = 0x4C545044;    // "DPTL"
+        constexpr uint32_t FILE_VERSION = 1;
+
+        enum class RecordType : uint8_t
+        {
+            prediction = 1,
+            cast = 2,
+            outcome = 3
+        };
+
+#pragma pack(push, 1)
+        struct FileHeader
+        {
+            uint32_t magic = FILE_MAGIC;
+            uint32_t version = FILE_VERSION;
+        };
+
+        struct BlockHeader
+        {
+            uint8_t type;                 // RecordType
+            uint32_t rows;
+        };
+
+        struct PredictionRecord
+        {
+            enum Flags : uint8_t
+            {
+                VALID = 1 << 0,
+                PEAK_OPPORTUNITY = 1 << 1,
+                HAS_PATTERN = 1 << 2
+            };
+
+            uint32_t id;                  // Sequence number (cast / outcome records refer to it)
+            float time;
+            uint32_t source_id;
+            uint32_t target_id;
+            uint8_t spell_type;           // pred_sdk::spell_type
+            int8_t spell_slot;
+            int8_t expected_hitchance;    // pred_sdk::hitchance (-1 = automatic)
+            uint8_t flags;
+            float hit_chance;
+            float physics_contribution;
+            float behavior_contribution;
+            float confidence_score;
+            float opportunity_score;
+            float pattern_confidence;
+            float cast_position[2];       // x, z
+        };
+
+        struct CastRecord
+        {
+            uint32_t prediction_id;
+            float time;
+            float cast_position[2];       // Actual cast, x, z
+        };
+
+        struct OutcomeRecord
+        {
+            enum Result : uint8_t
+            {
+                MISS = 0,
+                HIT = 1,
+                UNKNOWN = 2               // Target gone / dead before arrival
+            };
+
+            uint32_t prediction_id;
+            float time;                   // Arrival time
+            uint8_t result;
+            float miss_distance;          // Target to spell area center line, minus reach (<= 0 = hit)
+        };
+#pragma pack(pop)
+
+        /**
+         * Field layout written per block (one contiguous array per entry)
+         */
+        struct Column
+        {
+            uint16_t offset;
+            uint16_t size;
+        };
+
+        inline constexpr std::array<Column, 15> PREDICTION_COLUMNS = { {
+            { offsetof(PredictionRecord, id), sizeof(uint32_t) },
+            { offsetof(PredictionRecord, time), sizeof(float) },
+            { offsetof(PredictionRecord, source_id), sizeof(uint32_t) },
+            { offsetof(PredictionRecord, target_id), sizeof(uint32_t) },
+            { offsetof(PredictionRecord, spell_type), sizeof(uint8_t) },
+            { offsetof(PredictionRecord, spell_slot), sizeof(int8_t) },
+            { offsetof(PredictionRecord, expected_hitchance), sizeof(int8_t) },
+            { offsetof(PredictionRecord, flags), sizeof(uint8_t) },
+            { offsetof(PredictionRecord, hit_chance), sizeof(float) },
+            { offsetof(PredictionRecord, physics_contribution), sizeof(float) },
+            { offsetof(PredictionRecord, behavior_contribution), sizeof(float) },
+            { offsetof(PredictionRecord, confidence_score), sizeof(float) },
+            { offsetof(PredictionRecord, opportunity_score), sizeof(float) },
+            { offsetof(PredictionRecord, pattern_confidence), sizeof(float) },
+            { offsetof(PredictionRecord, cast_position), 2 * sizeof(float) }
+        } };
+
+        inline constexpr std::array<Column, 3> CAST_COLUMNS = { {
+            { offsetof(CastRecord, prediction_id), sizeof(uint32_t) },
+            { offsetof(CastRecord, time), sizeof(float) },
+            { offsetof(CastRecord, cast_position), 2 * sizeof(float) }
+        } };
+
+        inline constexpr std::array<Column, 4> OUTCOME_COLUMNS = { {
+            { offsetof(OutcomeRecord, prediction_id), sizeof(uint32_t) },
+            { offsetof(OutcomeRecord, time), sizeof(float) },
+            { offsetof(OutcomeRecord, result), sizeof(uint8_t) },
+            { offsetof(OutcomeRecord, miss_distance), sizeof(float) }
+        } };
+
+        /**
+         * One ring entry (tagged union of the record kinds)
+         */
+        struct Record
+        {
+            RecordType type;
+            union
+            {
+                PredictionRecord prediction;
+                CastRecord cast;
+                OutcomeRecord outcome;
+            };
+        };
+
+        /**
+         * Lock-free single-producer / single-consumer ring of trivially copyable T
+         * push() fails instead of blocking when full.
+         */
+        template<typename T, size_t N>
+        class SpscRing
+        {
+            static_assert((N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+
+        public:
+            // Producer side
+            bool push(const T& value)
+            {
+                size_t head = head_.load(std::memory_order_relaxed);
+                if (head - tail_cache_ == N)
+                {
+                    tail_cache_ = tail_.load(std::memory_order_acquire);
+                    if (head - tail_cache_ == N)
+                        return false;
+                }
+
+                slots_[head & (N - 1)] = value;
+                head_.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            // Consumer side
+            bool pop(T& value)
+            {
+                size_t tail = tail_.load(std::memory_order_relaxed);
+                if (tail == head_.load(std::memory_order_acquire))
+                    return false;
+
+                value = slots_[tail & (N - 1)];
+                tail_.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+        private:
+            std::array<T, N> slots_;
+            alignas(64) std::atomic<size_t> head_{ 0 };  // Producer owned
+            size_t tail_cache_ = 0;                      // Producer's last view of tail_
+            alignas(64) std::atomic<size_t> tail_{ 0 };  // Consumer owned
+        };
+
+        // =====================================================================
+        // RECORDER
+        // =====================================================================
+
+        class Recorder
+        {
+        public:
+            static constexpr size_t RING_CAPACITY = 4096;        // ~200 KB, several frames of predictions
+            static constexpr uint32_t BLOCK_ROWS = 1024;         // Rows per column block
+            static constexpr float CAST_MATCH_WINDOW = 0.5f;     // Prediction -> cast, seconds
+            static constexpr size_t MAX_PENDING = 32;            // Casts awaiting their outcome
+            static constexpr int SLOT_COUNT = 12;                // Spell slots -1..10
+
+            struct Stats
+            {
+                uint64_t predictions = 0;
+                uint64_t casts = 0;
+                uint64_t outcomes = 0;
+                uint64_t dropped = 0;    // Ring full
+            };
+
+            /**
+             * True when telemetry is enabled; starts the writer on first use
+             */
+            static bool is_active()
+            {
+                if (!PredictionConfig::get().enable_outcome_telemetry)
+                    return false;
+
+                State& telemetry = state();
+                if (!telemetry.thread.joinable() && !telemetry.open_failed)
+                    start(PredictionConfig::get().telemetry_path);
+
+                return telemetry.thread.joinable();
+            }
+
+            // Game thread: one record per computed prediction
+            static void record_prediction(game_object* source, game_object* target,
+                const pred_sdk::spell_data& spell, const HybridPredictionResult& result,
+                const DodgePattern& pattern);
+
+            // Game thread: process_cast callback (casts by anything, filtered here)
+            static void on_process_cast(game_object* object, spell_cast* cast);
+
+            // Game thread: resolve due outcomes and wake the writer (once per game_update)
+            static void end_frame(float current_time);
+
+            static const Stats& get_stats() { return state().stats; }
+
+            // File the current session writes to (empty until started)
+            static const char* get_session_path() { return state().session_path; }
+
+            /**
+             * Drain everything, write the last partial blocks and close (PredictionManager::clear)
+             */
+            static void shutdown()
+            {
+                State& telemetry = state();
+                if (telemetry.thread.joinable())
+                {
+                    telemetry.running.store(false, std::memory_order_release);
+                    telemetry.frames.fetch_add(1, std::memory_order_release);
+                    telemetry.frames.notify_one();
+                    telemetry.thread.join();
+                }
+
+                telemetry.open_failed = false;
+                telemetry.pending_count = 0;
+                for (auto& last : telemetry.last_predictions)
+                    last.valid = false;
+            }
+
+        private:
+            struct LastPrediction
+            {
+                bool valid = false;
+                uint32_t id = 0;
+                float time = 0.f;
+                uint32_t source_id = 0;
+                uint32_t target_id = 0;
+                uint8_t spell_type = 0;
+                float radius = 0.f;
+                float delay = 0.f;
+                float projectile_speed = 0.f;
+                math::vector3 source_position;
+                math::vector3 line_start;            // Vector spells: first cast position
+                math::vector3 cast_position;
+            };
+
+            struct PendingOutcome
+            {
+                LastPrediction prediction;
+                float due_time;
+            };
+
+            static void start(const char* path);
+            static void run();
+            static void push(const Record& record);
+
+            template<typename T, size_t C>
+            static void write_block(FILE* file, RecordType type, std::vector<T>& rows,
+                const std::array<Column, C>& columns, std::vector<uint8_t>& scratch)
+            {
+                if (rows.empty())
+                    return;
+
+                BlockHeader header{ static_cast<uint8_t>(type), static_cast<uint32_t>(rows.size()) };
+                std::fwrite(&header, sizeof(header), 1, file);
+
+                // Transpose rows into one contiguous array per column, single write
+                size_t row_bytes = 0;
+                for (const Column& column : columns)
+                    row_bytes += column.size;
+                scratch.resize(row_bytes * rows.size());
+
+                uint8_t* out = scratch.data();
+                for (const Column& column : columns)
+                {
+                    for (const T& row : rows)
+                    {
+                        std::memcpy(out, reinterpret_cast<const uint8_t*>(&row) + column.offset, column.size);
+                        out += column.size;
+                    }
+                }
+
+                std::fwrite(scratch.data(), 1, scratch.size(), file);
+                rows.clear();
+            }
+
+            struct State
+            {
+                SpscRing<Record, RING_CAPACITY> ring;            // Game thread -> writer
+                std::thread thread;
+                std::atomic<bool> running{ false };
+                std::atomic<uint32_t> frames{ 0 };
+                FILE* file = nullptr;                            // Writer only once started
+                char session_path[260] = {};
+                bool open_failed = false;
+                uint32_t next_id = 0;                            // Game thread only from here down
+                std::array<LastPrediction, SLOT_COUNT> last_predictions;
+                std::array<PendingOutcome, MAX_PENDING> pending;
+                size_t pending_count = 0;
+                Stats stats;
+
+                // Joining here could deadlock on the loader lock, and a detached writer
+                // would outlive this state (and the module's code), so shutdown() must
+                // already have run
+                ~State()
+                {
+                    assert(!thread.joinable() && "Telemetry::Recorder::shutdown() must run before unload");
+                }
+            };
+
+            static State& state()
+            {
+                static State instance;
+                return instance;
+            }
+        };
+
+        // =====================================================================
+        // READER
+        // =====================================================================
+
+        struct TelemetryData
+        {
+            std::vector<PredictionRecord> predictions;
+            std::vector<CastRecord> casts;
+            std::vector<OutcomeRecord> outcomes;
+            uint32_t next_id = 0;         // One past the largest prediction id loaded so far
+            int sessions = 0;             // Files loaded
+        };
+
+        namespace detail
+        {
+            template<typename T, size_t C>
+            bool read_block(FILE* file, uint32_t rows, const std::array<Column, C>& columns,
+                std::vector<T>& out, std::vector<uint8_t>& scratch)
+            {
+                size_t first = out.size();
+                out.resize(first + rows);
+
+                for (const Column& column : columns)
+                {
+                    scratch.resize(static_cast<size_t>(column.size) * rows);
+                    if (std::fread(scratch.data(), 1, scratch.size(), file) != scratch.size())
+                    {
+                        out.resize(first);
+                        return false;
+                    }
+
+                    const uint8_t* in = scratch.data();
+                    for (uint32_t r = 0; r < rows; ++r, in += column.size)
+                        std::memcpy(reinterpret_cast<uint8_t*>(&out[first + r]) + column.offset, in, column.size);
+                }
+                return true;
+            }
+        }
+
+        /**
+         * Load a whole telemetry file, appending to data; returns false on open/header
+         * errors (truncated tail is dropped). Ids are offset past the rows already in
+         * data, so several session files merge without collisions.
+         */
+        inline bool load_telemetry(const char* path, TelemetryData& data)
+        {
+            FILE* file = std::fopen(path, "rb");
+            if (!file)
+                return false;
+
+            FileHeader header{};
+            if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+                header.magic != FILE_MAGIC || header.version != FILE_VERSION)
+            {
+                std::fclose(file);
+                return false;
+            }
+
+            uint32_t id_base = data.next_id;
+            size_t first_prediction = data.predictions.size();
+            size_t first_cast = data.casts.size();
+            size_t first_outcome = data.outcomes.size();
+
+            std::vector<uint8_t> scratch;
+            BlockHeader block{};
+            while (std::fread(&block, sizeof(block), 1, file) == 1)
+            {
+                bool complete = false;
+                switch (static_cast<RecordType>(block.type))
+                {
+                case RecordType::prediction:
+                    complete = detail::read_block(file, block.rows, PREDICTION_COLUMNS, data.predictions, scratch);
+                    break;
+                case RecordType::cast:
+                    complete = detail::read_block(file, block.rows, CAST_COLUMNS, data.casts, scratch);
+                    break;
+                case RecordType::outcome:
+                    complete = detail::read_block(file, block.rows, OUTCOME_COLUMNS, data.outcomes, scratch);
+                    break;
+                }
+
+                if (!complete)
+                    break;  // Unknown block or truncated (game closed mid-write)
+            }
+
+            std::fclose(file);
+
+            for (size_t i = first_prediction; i < data.predictions.size(); ++i)
+            {
+                data.predictions[i].id += id_base;
+                data.next_id = std::max(data.next_id, data.predictions[i].id + 1);
+            }
+            for (size_t i = first_cast; i < data.casts.size(); ++i)
+                data.casts[i].prediction_id += id_base;
+            for (size_t i = first_outcome; i < data.outcomes.size(); ++i)
+                data.outcomes[i].prediction_id += id_base;
+
+            ++data.sessions;
+            return true;
+        }
+
+    } // namespace Telemetry
+} // namespace HybridPred
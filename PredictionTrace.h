@@ -0,0 +1,210 @@
+#pragma once
+
+#include "sdk.hpp"
+#include "PredictionConfig.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+/**
+ * =============================================================================
+ * PREDICTION TRACE RECORDING
+ * =============================================================================
+ *
+ * Compact binary trace of live games for offline replay (PredictionReplay.cpp):
+ * every sampled MovementSnapshot plus every computed prediction request with
+ * the live result. Actual outcomes are reconstructed at replay time from the
+ * target's later snapshots, so recording adds no deferred bookkeeping.
+ *
+ * File layout (little-endian, version 1):
+ *   TraceHeader, then records of { RecordType tag, payload }.
+ *   Payloads are packed PODs; records are appended in game-time order.
+ *
+ * Enable with PredictionConfig::enable_trace_recording (trace_path).
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+    struct MovementSnapshot;
+
+    namespace Trace
+    {
+        constexpr uint32_t TRACE_MAGIC = 0x52545044;   // "DPTR"
+        constexpr uint32_t TRACE_VERSION = 1;
+
+        enum class RecordType : uint8_t
+        {
+            snapshot = 1,
+            request = 2
+        };
+
+#pragma pack(push, 1)
+        struct TraceHeader
+        {
+            uint32_t magic = TRACE_MAGIC;
+            uint32_t version = TRACE_VERSION;
+        };
+
+        struct SnapshotRecord
+        {
+            enum Flags : uint8_t
+            {
+                AUTO_ATTACKING = 1 << 0,
+                CASTING = 1 << 1,
+                DASHING = 1 << 2,
+                CCED = 1 << 3
+            };
+
+            uint32_t network_id;
+            float timestamp;
+            float position[3];
+            float hp_percent;
+            float move_speed;
+            float bounding_radius;
+            uint8_t flags;
+        };
+
+        struct RequestRecord
+        {
+            float time;
+            uint32_t source_id;
+            uint32_t target_id;
+            float source_position[3];
+            float range;
+            float radius;
+            float delay;
+            float projectile_speed;
+            int16_t ping_ms;
+            uint8_t spell_type;           // pred_sdk::spell_type
+            uint8_t is_valid;             // Live result
+            float hit_chance;             // Live result
+            float cast_position[3];       // Live result
+        };
+#pragma pack(pop)
+
+        /**
+         * Parsed trace (records kept in file order)
+         */
+        struct TraceRecord
+        {
+            RecordType type;
+            SnapshotRecord snapshot;
+            RequestRecord request;
+        };
+
+        // =====================================================================
+        // RECORDER
+        // =====================================================================
+
+        class Recorder
+        {
+        public:
+            /**
+             * True when recording is enabled and the trace file is open (opens lazily)
+             */
+            static bool is_active()
+            {
+                const auto& config = PredictionConfig::get();
+                if (!config.enable_trace_recording)
+                    return false;
+
+                if (!file_ && !open_failed_)
+                    open(config.trace_path);
+
+                return file_ != nullptr;
+            }
+
+            static void record_snapshot(uint32_t network_id, const MovementSnapshot& snapshot,
+                float move_speed, float bounding_radius);
+
+            static void record_request(game_object* source, game_object* target,
+                const pred_sdk::spell_data& spell, bool is_valid, float hit_chance,
+                const math::vector3& cast_position);
+
+            static void close()
+            {
+                if (file_)
+                    std::fclose(file_);
+                file_ = nullptr;
+                open_failed_ = false;
+            }
+
+        private:
+            static void open(const char* path)
+            {
+                file_ = (path && path[0]) ? std::fopen(path, "wb") : nullptr;
+                if (!file_)
+                {
+                    open_failed_ = true;
+                    return;
+                }
+
+                // Large stdio buffer: records are tiny and arrive every frame
+                std::setvbuf(file_, nullptr, _IOFBF, 1 << 16);
+
+                TraceHeader header;
+                std::fwrite(&header, sizeof(header), 1, file_);
+            }
+
+            template<typename T>
+            static void write(RecordType type, const T& payload)
+            {
+                std::fputc(static_cast<int>(type), file_);
+                std::fwrite(&payload, sizeof(T), 1, file_);
+            }
+
+            static inline FILE* file_ = nullptr;
+            static inline bool open_failed_ = false;
+        };
+
+        // =====================================================================
+        // READER
+        // =====================================================================
+
+        /**
+         * Load a whole trace; returns false on open/header errors (truncated tail is dropped)
+         */
+        inline bool load_trace(const char* path, std::vector<TraceRecord>& records)
+        {
+            FILE* file = std::fopen(path, "rb");
+            if (!file)
+                return false;
+
+            TraceHeader header{};
+            if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+                header.magic != TRACE_MAGIC || header.version != TRACE_VERSION)
+            {
+                std::fclose(file);
+                return false;
+            }
+
+            for (;;)
+            {
+                int tag = std::fgetc(file);
+                if (tag == EOF)
+                    break;
+
+                TraceRecord record{};
+                record.type = static_cast<RecordType>(tag);
+
+                bool complete = false;
+                if (record.type == RecordType::snapshot)
+                    complete = std::fread(&record.snapshot, sizeof(SnapshotRecord), 1, file) == 1;
+                else if (record.type == RecordType::request)
+                    complete = std::fread(&record.request, sizeof(RequestRecord), 1, file) == 1;
+
+                if (!complete)
+                    break;  // Unknown tag or truncated record (game closed mid-write)
+
+                records.push_back(record);
+            }
+
+            std::fclose(file);
+            return true;
+        }
+
+    } // namespace Trace
+} // namespace HybridPred
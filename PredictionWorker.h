@@ -0,0 +1,309 @@
+#pragma once
+
+#include "HybridPrediction.h"
+#include "PredictionConfig.h"
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * =============================================================================
+ * BACKGROUND PDF WORKER
+ * =============================================================================
+ *
+ * Optional worker thread that builds behavior PDFs off the game thread.
+ *
+ * After PredictionManager::update() the game thread copies each visible
+ * enemy tracker's PDF inputs (movement history + learned patterns, see
+ * TargetBehaviorTracker::copy_pdf_inputs) into an immutable job and hands the
+ * batch over. The worker builds one PDF per prediction-time bucket with
+ * contextual factors applied, stores each as a CompactBehaviorPDF (active box,
+ * 16-bit cells) and publishes the set. Both directions use a
+ * lock-free triple buffer: the producer never waits, and the consumer always
+ * sees the newest complete batch.
+ *
+ * TargetBehaviorTracker::get_behavior_pdf takes a published PDF on a cache
+ * miss when it was built from the tracker's latest sample, with the same
+ * prediction time / move speed tolerances as the frame cache. Otherwise it
+ * builds synchronously, so a busy or disabled worker only costs speed.
+ *
+ * Enable with PredictionConfig::enable_pdf_worker (off by default).
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+    /**
+     * Single-producer / single-consumer triple buffer
+     * The producer fills back() and publish()es; the consumer acquire()s the
+     * newest published buffer into front(). Neither side blocks the other.
+     */
+    template<typename T>
+    class TripleBuffer
+    {
+    public:
+        // Producer side
+        T& back() { return buffers_[back_]; }
+
+        void publish()
+        {
+            back_ = middle_.exchange(static_cast<uint8_t>(back_ | FRESH), std::memory_order_acq_rel) & INDEX_MASK;
+        }
+
+        // Consumer side: true if a newer buffer was published since the last acquire
+        bool acquire()
+        {
+            if (!(middle_.load(std::memory_order_relaxed) & FRESH))
+                return false;
+
+            front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX_MASK;
+            return true;
+        }
+
+        const T& front() const { return buffers_[front_]; }
+        T& front() { return buffers_[front_]; }
+
+    private:
+        static constexpr uint8_t INDEX_MASK = 3;
+        static constexpr uint8_t FRESH = 4;
+
+        T buffers_[3];
+        uint8_t back_ = 0;                       // Producer owned
+        uint8_t front_ = 1;                      // Consumer owned
+        std::atomic<uint8_t> middle_{ 2 };       // Shared slot index (+ FRESH flag)
+    };
+
+    class PdfWorker
+    {
+    public:
+        static constexpr int BUCKET_COUNT = 15;
+        static constexpr float BUCKET_STEP = 0.1f;           // Bucket b covers prediction time (b + 1) * step
+        static constexpr size_t MAX_TARGETS = 5;             // Visible enemy champions per frame
+        static constexpr float TIME_TOLERANCE = 0.05f;       // Same as the tracker PDF cache
+        static constexpr float SPEED_TOLERANCE = 20.f;
+
+        /**
+         * Hand the visible enemy trackers to the worker (call after tracker updates)
+         * Starts the thread on first use; no-op while enable_pdf_worker is off
+         */
+        static void submit(const TrackerPool& trackers)
+        {
+            if (!PredictionConfig::get().enable_pdf_worker)
+            {
+                shutdown();
+                return;
+            }
+
+            State& worker = state();
+
+            if (!worker.thread.joinable())
+                start();
+
+            game_object* local_player = (g_sdk && g_sdk->object_manager) ? g_sdk->object_manager->get_local_player() : nullptr;
+            int local_team = local_player ? local_player->get_team_id() : -1;
+
+            JobBatch& batch = worker.jobs.back();
+            batch.count = 0;
+
+            for (size_t slot = 0; slot < trackers.capacity(); ++slot)
+            {
+                if (batch.count >= MAX_TARGETS)
+                    break;
+                if (!trackers.is_occupied(slot))
+                    continue;
+
+                const TargetBehaviorTracker* tracker = &trackers.at(slot);
+                game_object* target = tracker->get_target();
+                if (!target || !target->is_valid() || target->is_dead() || !target->is_visible())
+                    continue;
+                if (local_player && target->get_team_id() == local_team)
+                    continue;
+
+                const MovementHistory& history = tracker->get_history();
+                if (history.empty())
+                    continue;
+
+                if (batch.jobs.size() <= batch.count)
+                    batch.jobs.emplace_back();
+
+                Job& job = batch.jobs[batch.count++];
+                if (!job.snapshot)
+                    job.snapshot = std::make_unique<TargetBehaviorTracker>(nullptr);
+
+                job.network_id = trackers.network_id(slot);
+                job.sample_time = history.timestamp(history.size() - 1);
+                job.move_speed = target->get_move_speed();
+                tracker->copy_pdf_inputs(*job.snapshot);
+            }
+
+            worker.jobs.publish();
+            worker.submitted.fetch_add(1, std::memory_order_release);
+            worker.submitted.notify_one();
+        }
+
+        /**
+         * Adopt the newest published PDF set (call once per game_update, before predictions)
+         */
+        static void acquire_results()
+        {
+            State& worker = state();
+            if (worker.thread.joinable())
+                worker.results.acquire();
+        }
+
+        /**
+         * Published PDF for this target, or nullptr (stale sample, bucket/speed mismatch)
+         * Expand into a BehaviorPDF before use (CompactBehaviorPDF::expand)
+         */
+        static const CompactBehaviorPDF* find(uint32_t network_id, float sample_time, float prediction_time, float move_speed)
+        {
+            State& worker = state();
+            if (!worker.thread.joinable())
+                return nullptr;
+
+            int bucket = static_cast<int>(std::lround(prediction_time / BUCKET_STEP)) - 1;
+            bool bucket_ok = bucket >= 0 && bucket < BUCKET_COUNT &&
+                std::abs(prediction_time - (bucket + 1) * BUCKET_STEP) < TIME_TOLERANCE;
+
+            const ResultBatch& batch = worker.results.front();
+            for (size_t i = 0; i < batch.count && bucket_ok; ++i)
+            {
+                const TargetPdfs& target = *batch.targets[i];
+                if (target.network_id != network_id)
+                    continue;
+
+                if (target.sample_time != sample_time || std::abs(target.move_speed - move_speed) >= SPEED_TOLERANCE)
+                    break;
+
+                ++worker.stats.hits;
+                return &target.pdfs[bucket];
+            }
+
+            ++worker.stats.misses;
+            return nullptr;
+        }
+
+        // hits = PDFs served from the worker, misses = synchronous fallbacks
+        static const CacheStats& get_stats() { return state().stats; }
+
+        /**
+         * Stop and join the worker (PredictionManager::clear, or when disabled)
+         */
+        static void shutdown()
+        {
+            State& worker = state();
+            if (!worker.thread.joinable())
+                return;
+
+            worker.running.store(false, std::memory_order_release);
+            worker.submitted.fetch_add(1, std::memory_order_release);
+            worker.submitted.notify_one();
+            worker.thread.join();
+
+            worker.results.front().count = 0;
+            worker.stats = CacheStats{};
+        }
+
+    private:
+        struct Job
+        {
+            uint32_t network_id = 0;
+            float sample_time = -1.f;                        // Latest history timestamp in snapshot
+            float move_speed = 0.f;
+            std::unique_ptr<TargetBehaviorTracker> snapshot; // PDF inputs only (no target, empty caches)
+        };
+
+        struct JobBatch
+        {
+            std::vector<Job> jobs;                           // Reused across frames
+            size_t count = 0;
+        };
+
+        struct TargetPdfs
+        {
+            uint32_t network_id = 0;
+            float sample_time = -1.f;
+            float move_speed = 0.f;
+            CompactBehaviorPDF pdfs[BUCKET_COUNT];           // Contextual factors applied
+        };
+
+        struct ResultBatch
+        {
+            std::vector<std::unique_ptr<TargetPdfs>> targets;   // Heap slots reused across frames
+            size_t count = 0;
+        };
+
+        static void start()
+        {
+            State& worker = state();
+            worker.running.store(true, std::memory_order_release);
+            worker.thread = std::thread(run);
+        }
+
+        static void run()
+        {
+            State& worker = state();
+            uint32_t seen = 0;
+            while (worker.running.load(std::memory_order_acquire))
+            {
+                worker.submitted.wait(seen, std::memory_order_acquire);
+                seen = worker.submitted.load(std::memory_order_acquire);
+
+                if (!worker.running.load(std::memory_order_acquire))
+                    break;
+                if (!worker.jobs.acquire())
+                    continue;
+
+                const JobBatch& batch = worker.jobs.front();
+                ResultBatch& out = worker.results.back();
+                out.count = 0;
+
+                // Dense build scratch (~8 KB, off the worker's stack)
+                BehaviorPDF& pdf = *worker.scratch;
+
+                for (size_t i = 0; i < batch.count; ++i)
+                {
+                    const Job& job = batch.jobs[i];
+                    if (out.targets.size() <= out.count)
+                        out.targets.push_back(std::make_unique<TargetPdfs>());
+
+                    TargetPdfs& target = *out.targets[out.count++];
+                    target.network_id = job.network_id;
+                    target.sample_time = job.sample_time;
+                    target.move_speed = job.move_speed;
+
+                    for (int b = 0; b < BUCKET_COUNT; ++b)
+                    {
+                        pdf = job.snapshot->build_behavior_pdf((b + 1) * BUCKET_STEP, job.move_speed);
+                        BehaviorPredictor::apply_contextual_factors(pdf, *job.snapshot, nullptr);
+                        target.pdfs[b].compress(pdf);
+                    }
+                }
+
+                worker.results.publish();
+            }
+        }
+
+        struct State
+        {
+            TripleBuffer<JobBatch> jobs;                     // Game thread -> worker
+            TripleBuffer<ResultBatch> results;               // Worker -> game thread
+            std::unique_ptr<BehaviorPDF> scratch = std::make_unique<BehaviorPDF>();   // Worker only
+            std::thread thread;
+            std::atomic<bool> running{ false };
+            std::atomic<uint32_t> submitted{ 0 };
+            CacheStats stats;                                // Game thread only
+        };
+
+        static State& state()
+        {
+            static State instance;
+            return instance;
+        }
+    };
+
+} // namespace HybridPred
@@ -0,0 +1,307 @@
+#pragma once
+
+#include "HybridPrediction.h"
+#include "PredictionConfig.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/**
+ * =============================================================================
+ * PERSISTENT CHAMPION BEHAVIOR PROFILES
+ * =============================================================================
+ *
+ * Per-champion priors (dodge direction frequencies, juke interval stats,
+ * reaction delay) learned across games, so a fresh tracker starts from the
+ * champion's habits instead of the 0.5/0.5 defaults.
+ *
+ * The file is a fixed-size open-addressed table mapped read/write at load:
+ * lookups read the mapped records directly (no parse step) and harvested
+ * observations are merged in place. Dirty pages are written back by the OS;
+ * flush() only schedules the writeback (FlushViewOfFile / msync MS_ASYNC),
+ * so neither tracker releases nor unload wait on disk I/O.
+ *
+ * File layout (little-endian, version 1):
+ *   ProfileFileHeader, then CAPACITY ProfileRecords (champion_hash 0 = empty).
+ *   A header mismatch (magic / version / capacity) reinitializes the table.
+ *
+ * Merging: each enemy champion tracker contributes one observation when its
+ * lifetime ends (released after TRACKER_TIMEOUT, or PredictionManager::clear),
+ * if it gathered enough live data. Records keep a running mean over at most
+ * MAX_OBSERVATIONS, so games older than that fade out.
+ *
+ * Enable with PredictionConfig::enable_behavior_profiles (profile_path).
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+#pragma pack(push, 1)
+    struct ProfileFileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t capacity;
+        uint32_t reserved;
+    };
+
+    struct ProfileRecord
+    {
+        uint32_t champion_hash;          // FNV-1a of get_char_name(), 0 = empty slot
+        uint16_t dodge_observations;
+        uint16_t juke_observations;
+        uint16_t reaction_observations;
+        uint16_t reserved;
+        float left_dodge_frequency;
+        float right_dodge_frequency;
+        float forward_frequency;
+        float backward_frequency;
+        float juke_interval_mean;        // Seconds
+        float juke_interval_variance;
+        float reaction_delay;            // Milliseconds
+    };
+#pragma pack(pop)
+
+    /**
+     * One tracker's live statistics (TargetBehaviorTracker::observe_profile)
+     */
+    struct ProfileObservation
+    {
+        float left_dodge_frequency = 0.f;
+        float right_dodge_frequency = 0.f;
+        float forward_frequency = 0.f;
+        float backward_frequency = 0.f;
+        bool has_juke = false;
+        float juke_interval_mean = 0.f;
+        float juke_interval_variance = 0.f;
+        bool has_reaction = false;
+        float reaction_delay = 0.f;
+    };
+
+    class ProfileStore
+    {
+    public:
+        static constexpr uint32_t FILE_MAGIC = 0x46505044;     // "DPPF"
+        static constexpr uint32_t FILE_VERSION = 1;
+        static constexpr uint32_t CAPACITY = 256;              // Power of two (linear probing)
+        static constexpr uint16_t MAX_OBSERVATIONS = 64;       // Running-mean memory
+        static constexpr size_t FILE_SIZE = sizeof(ProfileFileHeader) + CAPACITY * sizeof(ProfileRecord);
+
+        static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+        static uint32_t champion_hash(const std::string& name)
+        {
+            uint32_t hash = 2166136261u;
+            for (char c : name)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 16777619u;
+            }
+            return hash ? hash : 1u;     // 0 marks empty slots
+        }
+
+        /**
+         * Map the profile file (created / reinitialized when missing or incompatible)
+         */
+        static bool open(const char* path)
+        {
+            close();
+
+            if (!path || !path[0] || !map(path))
+                return false;
+
+            ProfileFileHeader& header = *reinterpret_cast<ProfileFileHeader*>(view_);
+            if (header.magic != FILE_MAGIC || header.version != FILE_VERSION || header.capacity != CAPACITY)
+            {
+                std::memset(view_, 0, FILE_SIZE);
+                header.magic = FILE_MAGIC;
+                header.version = FILE_VERSION;
+                header.capacity = CAPACITY;
+            }
+
+            records_ = reinterpret_cast<ProfileRecord*>(view_ + sizeof(ProfileFileHeader));
+            return true;
+        }
+
+        static bool is_open() { return records_ != nullptr; }
+
+        /**
+         * Stored profile for champion, or nullptr (store closed / never seen)
+         */
+        static const ProfileRecord* find(uint32_t hash)
+        {
+            if (!records_)
+                return nullptr;
+
+            for (uint32_t probe = 0; probe < CAPACITY; ++probe)
+            {
+                const ProfileRecord& record = records_[(hash + probe) & (CAPACITY - 1)];
+                if (record.champion_hash == hash)
+                    return &record;
+                if (record.champion_hash == 0)
+                    return nullptr;
+            }
+            return nullptr;
+        }
+
+        /**
+         * Fold one observation into the champion's record (in place)
+         */
+        static void merge(uint32_t hash, const ProfileObservation& observation)
+        {
+            ProfileRecord* record = find_or_insert(hash);
+            if (!record)
+                return;
+
+            // Running mean over the last MAX_OBSERVATIONS observations
+            auto rate = [](uint16_t& count)
+            {
+                if (count < MAX_OBSERVATIONS)
+                    ++count;
+                return 1.f / count;
+            };
+
+            float dodge_rate = rate(record->dodge_observations);
+            record->left_dodge_frequency += (observation.left_dodge_frequency - record->left_dodge_frequency) * dodge_rate;
+            record->right_dodge_frequency += (observation.right_dodge_frequency - record->right_dodge_frequency) * dodge_rate;
+            record->forward_frequency += (observation.forward_frequency - record->forward_frequency) * dodge_rate;
+            record->backward_frequency += (observation.backward_frequency - record->backward_frequency) * dodge_rate;
+
+            if (observation.has_juke)
+            {
+                float juke_rate = rate(record->juke_observations);
+                record->juke_interval_mean += (observation.juke_interval_mean - record->juke_interval_mean) * juke_rate;
+                record->juke_interval_variance += (observation.juke_interval_variance - record->juke_interval_variance) * juke_rate;
+            }
+
+            if (observation.has_reaction)
+            {
+                float reaction_rate = rate(record->reaction_observations);
+                record->reaction_delay += (observation.reaction_delay - record->reaction_delay) * reaction_rate;
+            }
+        }
+
+        /**
+         * Schedule writeback of modified pages (returns without waiting for the disk)
+         */
+        static void flush()
+        {
+            if (!view_)
+                return;
+#ifdef _WIN32
+            FlushViewOfFile(view_, 0);
+#else
+            msync(view_, FILE_SIZE, MS_ASYNC);
+#endif
+        }
+
+        /**
+         * Flush and unmap (plugin unload)
+         */
+        static void close()
+        {
+            if (!view_)
+                return;
+
+            flush();
+#ifdef _WIN32
+            UnmapViewOfFile(view_);
+            CloseHandle(mapping_);
+            CloseHandle(file_);
+            mapping_ = nullptr;
+            file_ = INVALID_HANDLE_VALUE;
+#else
+            munmap(view_, FILE_SIZE);
+            ::close(file_);
+            file_ = -1;
+#endif
+            view_ = nullptr;
+            records_ = nullptr;
+        }
+
+    private:
+        static ProfileRecord* find_or_insert(uint32_t hash)
+        {
+            if (!records_)
+                return nullptr;
+
+            for (uint32_t probe = 0; probe < CAPACITY; ++probe)
+            {
+                ProfileRecord& record = records_[(hash + probe) & (CAPACITY - 1)];
+                if (record.champion_hash == hash)
+                    return &record;
+                if (record.champion_hash == 0)
+                {
+                    std::memset(&record, 0, sizeof(record));
+                    record.champion_hash = hash;
+                    return &record;
+                }
+            }
+            return nullptr;              // Table full (more champions than CAPACITY)
+        }
+
+        static bool map(const char* path)
+        {
+#ifdef _WIN32
+            file_ = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file_ == INVALID_HANDLE_VALUE)
+                return false;
+
+            // Mapping FILE_SIZE bytes extends a new / short file (zero-filled)
+            mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(FILE_SIZE), nullptr);
+            view_ = mapping_ ? static_cast<uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_WRITE, 0, 0, FILE_SIZE)) : nullptr;
+            if (!view_)
+            {
+                if (mapping_)
+                    CloseHandle(mapping_);
+                CloseHandle(file_);
+                mapping_ = nullptr;
+                file_ = INVALID_HANDLE_VALUE;
+                return false;
+            }
+#else
+            file_ = ::open(path, O_RDWR | O_CREAT, 0644);
+            if (file_ < 0)
+                return false;
+
+            struct stat info;
+            if (fstat(file_, &info) != 0 ||
+                (static_cast<size_t>(info.st_size) < FILE_SIZE && ftruncate(file_, FILE_SIZE) != 0))
+            {
+                ::close(file_);
+                file_ = -1;
+                return false;
+            }
+
+            void* view = mmap(nullptr, FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, file_, 0);
+            if (view == MAP_FAILED)
+            {
+                ::close(file_);
+                file_ = -1;
+                return false;
+            }
+            view_ = static_cast<uint8_t*>(view);
+#endif
+            return true;
+        }
+
+        static inline uint8_t* view_ = nullptr;
+        static inline ProfileRecord* records_ = nullptr;
+#ifdef _WIN32
+        static inline HANDLE file_ = INVALID_HANDLE_VALUE;
+        static inline HANDLE mapping_ = nullptr;
+#else
+        static inline int file_ = -1;
+#endif
+    };
+
+} // namespace HybridPred
@@ -0,0 +1,319 @@
+#pragma once
+
+#include "sdk.hpp"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * =============================================================================
+ * REPLAY SDK
+ * =============================================================================
+ *
+ * Minimal in-process stand-ins for the native SDK interfaces so the prediction
+ * pipeline can run headless against a recorded trace (PredictionReplay.cpp).
+ *
+ * Only the state the pipeline reads from targets is backed by recorded data
+ * (position, move speed, hp, bounding radius, dash flag). Everything else
+ * returns a neutral default: no buffs, no active casts, no path, no minions.
+ *
+ * =============================================================================
+ */
+
+namespace HybridPred
+{
+    namespace Replay
+    {
+        /**
+         * Champion driven by trace snapshots
+         */
+        class ReplayGameObject final : public game_object
+        {
+        public:
+            uint32_t network_id = 0;
+            int team_id = 0;
+            std::string name = "replay";
+            math::vector3 position{};
+            float hp = 100.f;
+            float max_hp = 100.f;
+            float move_speed = 0.f;
+            float bounding_radius = 65.f;
+            bool is_dashing_ = false;
+
+            uint32_t get_id() override { return network_id; }
+            int get_team_id() override { return team_id; }
+            std::string get_name() override { return name; }
+            uint32_t get_network_id() override { return network_id; }
+            math::vector3 get_min_bounding_box() override { return {}; }
+            math::vector3 get_max_bounding_box() override { return {}; }
+            math::vector3 get_position() override { return position; }
+            float get_par() override { return {}; }
+            float get_max_par() override { return {}; }
+            int get_par_enabled() override { return {}; }
+            int get_par_state() override { return {}; }
+            float get_sar() override { return {}; }
+            float get_max_sar() override { return {}; }
+            int get_sar_enabled() override { return {}; }
+            int get_sar_state() override { return {}; }
+            float get_hp() override { return hp; }
+            float get_max_hp() override { return max_hp; }
+            float get_hp_max_penalty() override { return {}; }
+            float get_all_shield() override { return {}; }
+            float get_physical_shield() override { return {}; }
+            float get_magical_shield() override { return {}; }
+            float get_champ_specific_health() override { return {}; }
+            float get_stop_shield_fade() override { return {}; }
+            math::vector3 get_direction() override { return {}; }
+            std::string get_char_name() override { return name; }
+            int get_evolve_points() override { return {}; }
+            int get_evolve_flag() override { return {}; }
+            int get_level() override { return {}; }
+            float get_experience() override { return {}; }
+            float get_experience_percent() override { return {}; }
+            int get_skill_points() override { return {}; }
+            int get_current_plates() override { return {}; }
+            int get_max_plates() override { return {}; }
+            float get_percent_cooldown_mod() override { return {}; }
+            float get_ability_haste_mod() override { return {}; }
+            float get_percent_cooldown_cap_mod() override { return {}; }
+            float get_passive_cooldown_end_time() override { return {}; }
+            float get_passive_cooldown_total_time() override { return {}; }
+            float get_percent_damage_to_barracks_minion_mod() override { return {}; }
+            float get_flat_damage_reduction_from_barracks_minion_mod() override { return {}; }
+            float get_increased_move_speed_minion_mod() override { return {}; }
+            float get_flat_physical_damage_mod() override { return {}; }
+            float get_percent_physical_damage_mod() override { return {}; }
+            float get_percent_bonus_physical_damage_mod() override { return {}; }
+            float get_percent_base_physical_damage_as_flat_bonus_mod() override { return {}; }
+            float get_flat_magic_damage_mod() override { return {}; }
+            float get_percent_magic_damage_mod() override { return {}; }
+            float get_flat_magic_reduction() override { return {}; }
+            float get_percent_magic_reduction() override { return {}; }
+            float get_flat_cast_range_mod() override { return {}; }
+            float get_attack_speed_mod() override { return {}; }
+            float get_percent_attack_speed_mod() override { return {}; }
+            float get_percent_multiplicative_attack_speed_mod() override { return {}; }
+            float get_base_attack_damage() override { return {}; }
+            float get_base_attack_damage_sans_percent_scale() override { return {}; }
+            float get_flat_base_attack_damage_mod() override { return {}; }
+            float get_percent_base_attack_damage_mod() override { return {}; }
+            float get_base_ability_damage() override { return {}; }
+            float get_crit_damage_multiplier() override { return {}; }
+            float get_scale_skin_coef() override { return {}; }
+            float get_dodge() override { return {}; }
+            float get_crit() override { return {}; }
+            float get_flat_base_hp_pool_mod() override { return {}; }
+            float get_armor() override { return {}; }
+            float get_bonus_armor() override { return {}; }
+            float get_magic_resist() override { return {}; }
+            float get_bonus_magic_resist() override { return {}; }
+            float get_hp_regen_rate() override { return {}; }
+            float get_base_hp_regen_rate() override { return {}; }
+            float get_move_speed() override { return move_speed; }
+            float get_move_speed_base_increase() override { return {}; }
+            float get_attack_range() override { return {}; }
+            float get_flat_bubble_radius_mod() override { return {}; }
+            float get_percent_bubble_radius_mod() override { return {}; }
+            float get_flat_armor_penetration() override { return {}; }
+            float get_physical_lethality() override { return {}; }
+            float get_percent_armor_penetration() override { return {}; }
+            float get_percent_bonus_armor_penetration() override { return {}; }
+            float get_percent_crit_bonus_armor_penetration() override { return {}; }
+            float get_percent_crit_total_armor_penetration() override { return {}; }
+            float get_flat_magic_penetration() override { return {}; }
+            float get_magic_lethality() override { return {}; }
+            float get_percent_magic_penetration() override { return {}; }
+            float get_percent_bonus_magic_penetration() override { return {}; }
+            float get_percent_life_steal_mod() override { return {}; }
+            float get_percent_spell_vamp_mod() override { return {}; }
+            float get_percent_omnivamp_mod() override { return {}; }
+            float get_percent_physical_vamp() override { return {}; }
+            float get_pathfinding_radius_mod() override { return {}; }
+            float get_percent_cc_reduction() override { return {}; }
+            float get_percent_exp_bonus() override { return {}; }
+            float get_primary_ar_regen_rate_rep() override { return {}; }
+            float get_primary_ar_base_regen_rate_rep() override { return {}; }
+            float get_secondary_ar_regen_rate_rep() override { return {}; }
+            float get_secondary_ar_base_regen_rate_rep() override { return {}; }
+            float get_attack_damage() override { return {}; }
+            float get_ability_power() override { return {}; }
+            bool is_melee() override { return {}; }
+            bool is_ranged() override { return {}; }
+            bool is_valid() override { return true; }
+            bool is_ai() override { return {}; }
+            bool is_hero() override { return true; }
+            bool is_minion() override { return {}; }
+            bool is_missile() override { return {}; }
+            bool is_turret() override { return {}; }
+            bool is_nexus() override { return {}; }
+            bool is_inhibitor() override { return {}; }
+            bool is_particle() override { return {}; }
+            bool is_champion_clone() override { return {}; }
+            bool is_lane_minion() override { return {}; }
+            bool is_lane_minion_melee() override { return {}; }
+            bool is_lane_minion_ranged() override { return {}; }
+            bool is_lane_minion_siege() override { return {}; }
+            bool is_lane_minion_super() override { return {}; }
+            bool is_monster() override { return {}; }
+            bool is_epic_monster() override { return {}; }
+            bool is_large_monster() override { return {}; }
+            bool is_medium_monster() override { return {}; }
+            bool is_buff_monster() override { return {}; }
+            bool is_trap() override { return {}; }
+            bool is_ward() override { return {}; }
+            bool is_plant() override { return {}; }
+            bool is_dead() override { return {}; }
+            bool is_zombie() override { return {}; }
+            bool is_visible() override { return true; }
+            bool is_targetable() override { return true; }
+            float get_attack_delay() override { return {}; }
+            float get_attack_cast_delay() override { return {}; }
+            game_object* get_attacher() override { return {}; }
+            game_object* get_owner() override { return {}; }
+            float get_bounding_radius() override { return bounding_radius; }
+            spell_entry* get_spell( int ) override { return {}; }
+            spell_data* get_basic_attack() override { return {}; }
+            float get_basic_attack_cooldown_expiration() override { return {}; }
+            math::vector2 get_health_bar_position() override { return {}; }
+            void* get_icon_circle() override { return {}; }
+            void* get_icon_square() override { return {}; }
+            float get_raw_spell_value( int, uint32_t ) override { return {}; }
+            std::vector< spell_static_data* > get_child_spells( int ) override { return {}; }
+            int get_spell_cast_state( int ) override { return {}; }
+            active_spell_cast* get_active_spell_cast() override { return {}; }
+            void set_skin( int ) override {}
+            void issue_order( game_object_order, math::vector3, bool ) override {}
+            void issue_order( game_object_order, game_object*, bool ) override {}
+            void cast_spell( int ) override {}
+            void cast_spell( int, math::vector3 ) override {}
+            void cast_spell( int, math::vector3, math::vector3 ) override {}
+            void cast_spell( int, game_object* ) override {}
+            void update_chargeable_spell( int, math::vector3, bool ) override {}
+            bool use_object( game_object* ) override { return {}; }
+            bool has_buff_of_type( buff_type ) override { return {}; }
+            std::vector< buff_instance* > get_buffs() override { return {}; }
+            buff_instance* get_buff_by_hash( uint32_t ) override { return {}; }
+            buff_instance* get_buff_by_name( std::string& ) override { return {}; }
+            bool is_moving() override { return {}; }
+            bool is_dashing() override { return is_dashing_; }
+            float get_dash_speed() override { return {}; }
+            math::vector3 get_server_position() override { return position; }
+            uint8_t get_current_path_index() override { return {}; }
+            std::span< math::vector3 > get_path() override { return {}; }
+            std::vector< math::vector3 > calculate_path( math::vector3 const& ) override { return {}; }
+            spell_cast* get_missile_spell_cast() override { return {}; }
+            math::vector3 get_missile_start_pos() override { return {}; }
+            math::vector3 get_missile_end_pos() override { return {}; }
+            math::vector3 get_particle_direction() override { return {}; }
+            bool is_in_bush() override { return {}; }
+            bool is_near_bush() override { return {}; }
+            char* get_search_tags() override { return {}; }
+            char* get_search_tags_secondary() override { return {}; }
+            float get_pathfinding_collision_radius() override { return {}; }
+            bool has_item( int, int* ) override { return {}; }
+            int get_item_id( int ) override { return {}; }
+            bool buy_item( uint32_t, uint8_t ) override { return {}; }
+            void sell_item( uint8_t ) override {}
+            bool undo_item() override { return {}; }
+            bool swap_item( uint8_t, uint8_t ) override { return {}; }
+            bool draw_outline( uint32_t ) override { return {}; }
+            bool draw_glow( uint32_t ) override { return {}; }
+            bool can_level_spell( int ) override { return {}; }
+            bool level_spell( int ) override { return {}; }
+            float get_respawn_time() override { return {}; }
+            bool is_clone() override { return {}; }
+            bool has_rune( uint32_t ) override { return {}; }
+            uint32_t get_rune_id( uint8_t ) override { return {}; }
+            bool can_evolve_spell( int ) override { return {}; }
+            game_object* get_turret_aggro_target() override { return {}; }
+            float get_rune_value( uint8_t, uint32_t ) override { return {}; }
+            bool cast_hwei_mood( int ) override { return {}; }
+            float get_missile_current_speed() override { return {}; }
+            math::vector3 get_velocity() override { return {}; }
+            float get_lifetime() override { return {}; }
+            float get_max_lifetime() override { return {}; }
+            float get_spell_mana_cost( int ) override { return {}; }
+            float get_item_param_value( int, item_param ) override { return {}; }
+        };
+
+        class ReplayClock final : public clock_facade
+        {
+        public:
+            float time = 0.f;
+
+            float get_game_time() override { return time; }
+        };
+
+        class ReplayNetClient final : public net_client
+        {
+        public:
+            int ping_ms = 0;
+
+            int get_ping() override { return ping_ms; }
+        };
+
+        /**
+         * Object manager exposing the replayed heroes (no minions: collision is not replayed)
+         */
+        class ReplayObjectManager final : public object_manager
+        {
+        public:
+            std::vector<game_object*> heroes;
+            std::unordered_map<uint32_t, game_object*> by_network_id;
+
+            game_object* get_local_player() override { return nullptr; }
+            std::span< game_object* > get_turrets() override { return {}; }
+            std::span< game_object* > get_heroes() override { return heroes; }
+            std::span< game_object* > get_minions() override { return {}; }
+            std::span< game_object* > get_nexuses() override { return {}; }
+            std::span< game_object* > get_inhibitors() override { return {}; }
+            std::span< game_object* > get_monsters() override { return {}; }
+            std::span< game_object* > get_traps() override { return {}; }
+            std::span< game_object* > get_wards() override { return {}; }
+            std::span< game_object* > get_plants() override { return {}; }
+
+            game_object* get_object_by_network_id( uint32_t network_id ) override
+            {
+                auto it = by_network_id.find(network_id);
+                return it != by_network_id.end() ? it->second : nullptr;
+            }
+        };
+
+        /**
+         * core_sdk wiring the replay facades (console output discarded)
+         */
+        class ReplayCoreSdk final : public core_sdk
+        {
+        public:
+            ReplayClock clock;
+            ReplayNetClient net;
+            ReplayObjectManager objects;
+
+            ReplayCoreSdk()
+            {
+                clock_facade = &clock;
+                net_client = &net;
+                object_manager = &objects;
+            }
+
+            void set_package( std::string const& ) override {}
+            bool add_dependency( std::string const& ) override { return {}; }
+            void* get_custom_sdk( std::string const& ) override { return {}; }
+            void* get_orb_sdk() override { return {}; }
+            void* get_pred_sdk() override { return {}; }
+            void* get_evade_sdk() override { return {}; }
+            void log_console( const char*, ... ) override {}
+            std::string get_username() override { return {}; }
+            uint32_t get_remaining_sub_days() override { return {}; }
+            bool is_replay_mode() override { return {}; }
+            char* get_engine_string( std::string const& ) override { return {}; }
+            bool is_chat_open() override { return {}; }
+            bool is_shop_open() override { return {}; }
+            bool get_height_precise_drawings_state() override { return {}; }
+            std::map< uint32_t, char* > get_buffs_hash_map() override { return {}; }
+        };
+
+    } // namespace Replay
+} // namespace HybridPred